@@ -0,0 +1,54 @@
+#pragma once
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace bb {
+
+struct BatchProofFiles {
+    std::filesystem::path proof_path;
+    std::filesystem::path vk_path;
+};
+
+/**
+ * @brief Lists the proofs of a batch directory along with the verification key of each, in order of file name
+ *
+ * The proofs are the files named proof or proof_<suffix>, as written by the prove commands. The *_fields.json files
+ * written next to them hold the same data as field elements and are skipped. The verification key of proof_<suffix>
+ * is vk_<suffix> if that file exists and the shared vk file otherwise.
+ *
+ * @throws std::runtime_error if the directory holds no proof
+ */
+inline std::vector<BatchProofFiles> find_batch_proofs(const std::filesystem::path& batch_dir)
+{
+    const std::string prefix = "proof";
+    const std::string fields_suffix = "_fields.json";
+
+    std::vector<BatchProofFiles> batch;
+    for (const auto& entry : std::filesystem::directory_iterator(batch_dir)) {
+        const std::string name = entry.path().filename().string();
+        if (!entry.is_regular_file() || !name.starts_with(prefix) || name.ends_with(fields_suffix)) {
+            continue;
+        }
+        const std::string suffix = name.substr(prefix.size());
+        if (!suffix.empty() && (suffix.size() == 1 || suffix[0] != '_')) {
+            continue;
+        }
+        std::filesystem::path vk_path = batch_dir / ("vk" + suffix);
+        if (suffix.empty() || !std::filesystem::exists(vk_path)) {
+            vk_path = batch_dir / "vk";
+        }
+        batch.push_back({ entry.path(), vk_path });
+    }
+    if (batch.empty()) {
+        throw std::runtime_error("No proofs found in " + batch_dir.string());
+    }
+    std::sort(batch.begin(), batch.end(), [](const BatchProofFiles& a, const BatchProofFiles& b) {
+        return a.proof_path < b.proof_path;
+    });
+    return batch;
+}
+
+} // namespace bb
@@ -0,0 +1,65 @@
+#include "batch_proofs.hpp"
+#include "barretenberg/bb/file_io.hpp"
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+using namespace bb;
+
+class BatchProofsTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        directory = std::filesystem::temp_directory_path() / ("bb_batch_proofs_" + std::string(test_info->name()));
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    void touch(const std::string& name) { write_file(directory / name, { 1 }); }
+
+    std::filesystem::path directory;
+};
+
+TEST_F(BatchProofsTest, SkipsFieldsFilesOfAProveOutputDirectory)
+{
+    // The files written by prove_honk_output_all
+    touch("proof");
+    touch("proof_fields.json");
+    touch("vk");
+    touch("vk_fields.json");
+
+    auto batch = find_batch_proofs(directory);
+    ASSERT_EQ(batch.size(), 1);
+    EXPECT_EQ(batch[0].proof_path, directory / "proof");
+    EXPECT_EQ(batch[0].vk_path, directory / "vk");
+}
+
+TEST_F(BatchProofsTest, MatchesEachProofToItsVerificationKey)
+{
+    touch("proof_0");
+    touch("proof_1");
+    touch("proof_1_fields.json");
+    touch("proofs.txt");
+    touch("vk");
+    touch("vk_1");
+
+    auto batch = find_batch_proofs(directory);
+    ASSERT_EQ(batch.size(), 2);
+    EXPECT_EQ(batch[0].proof_path, directory / "proof_0");
+    EXPECT_EQ(batch[0].vk_path, directory / "vk");
+    EXPECT_EQ(batch[1].proof_path, directory / "proof_1");
+    EXPECT_EQ(batch[1].vk_path, directory / "vk_1");
+}
+
+TEST_F(BatchProofsTest, ThrowsIfThereAreNoProofs)
+{
+    EXPECT_THROW(find_batch_proofs(directory), std::runtime_error);
+
+    touch("proof_fields.json");
+    touch("vk");
+    EXPECT_THROW(find_batch_proofs(directory), std::runtime_error);
+}
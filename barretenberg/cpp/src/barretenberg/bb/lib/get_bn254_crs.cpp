@@ -0,0 +1,175 @@
+#include "get_bn254_crs.hpp"
+#include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/common/mapped_file.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include "barretenberg/srs/point_table_cache.hpp"
+
+namespace {
+using namespace bb;
+
+std::vector<uint8_t> download_bn254_g1_data(size_t num_points)
+{
+    size_t g1_end = num_points * 64 - 1;
+
+    std::string url = "https://aztec-ignition.s3.amazonaws.com/MAIN%20IGNITION/flat/g1.dat";
+
+    // IMPORTANT: this currently uses a shell, DO NOT let user-controlled strings here.
+    std::string command = "curl -s -H \"Range: bytes=0-" + std::to_string(g1_end) + "\" '" + url + "'";
+
+    auto data = exec_pipe(command);
+    // Header + num_points * sizeof point.
+    if (data.size() < g1_end) {
+        throw std::runtime_error("Failed to download g1 data.");
+    }
+
+    return data;
+}
+
+std::vector<uint8_t> download_bn254_g2_data()
+{
+    std::string url = "https://aztec-ignition.s3.amazonaws.com/MAIN%20IGNITION/flat/g2.dat";
+    // IMPORTANT: this currently uses a shell, DO NOT let user-controlled strings here.
+    std::string command = "curl -s '" + url + "'";
+    return exec_pipe(command);
+}
+
+/**
+ * @brief Map bn254_g1.dat, downloading it first if it holds fewer than num_points points
+ */
+MappedFile map_bn254_g1_data(const std::filesystem::path& path, size_t num_points)
+{
+    auto g1_path = path / "bn254_g1.dat";
+    size_t g1_file_size = get_file_size(g1_path);
+    if (g1_file_size < num_points * 64 || g1_file_size % 64 != 0) {
+        vinfo("downloading bn254 crs...");
+        write_file(g1_path, download_bn254_g1_data(num_points));
+    }
+
+    MappedFile file(g1_path.string());
+    if (!file || file.size() < num_points * 64) {
+        throw std::runtime_error("Failed to map g1 data at " + g1_path.string());
+    }
+    vinfo("mapping cached bn254 crs of size ", std::to_string(file.size() / 64), " at ", g1_path);
+    return file;
+}
+
+/**
+ * @brief Convert the points of a mapping of bn254_g1.dat, from the one at index start on, in parallel
+ */
+void load_bn254_g1_points(const MappedFile& file, size_t start, std::span<g1::affine_element> points)
+{
+    file.will_need(start * 64, points.size() * 64);
+    const uint8_t* data = file.data().data() + start * 64;
+    parallel_for_range(points.size(), [&](size_t range_start, size_t range_end) {
+        for (size_t i = range_start; i < range_end; ++i) {
+            points[i] = g1::affine_element::serialize_from_buffer(data + i * 64, /*write_x_first=*/true);
+        }
+    });
+}
+
+/**
+ * @brief Build the prover crs by converting the points of bn254_g1.dat straight out of a read-only mapping into the
+ * pippenger point table, in parallel. Unlike get_bn254_g1_data this never copies the file into a byte vector or the
+ * points into a point vector.
+ */
+std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> get_bn254_prover_crs_mapped(const std::filesystem::path& path,
+                                                                                      size_t num_points)
+{
+    auto file = map_bn254_g1_data(path, num_points);
+    return std::make_shared<srs::factories::MemProverCrs<curve::BN254>>(
+        num_points, [&](std::span<g1::affine_element> points) { load_bn254_g1_points(file, 0, points); });
+}
+} // namespace
+
+namespace bb {
+std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points)
+{
+    std::filesystem::create_directories(path);
+
+    auto g1_path = path / "bn254_g1.dat";
+    size_t g1_file_size = get_file_size(g1_path);
+
+    if (g1_file_size >= num_points * 64 && g1_file_size % 64 == 0) {
+        vinfo("using cached bn254 crs of size ", std::to_string(g1_file_size / 64), " at ", g1_path);
+        auto data = read_file(g1_path, num_points * 64);
+        auto points = std::vector<g1::affine_element>(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            points[i] = from_buffer<g1::affine_element>(data, i * 64);
+        }
+        return points;
+    }
+
+    vinfo("downloading bn254 crs...");
+    auto data = download_bn254_g1_data(num_points);
+    write_file(g1_path, data);
+
+    auto points = std::vector<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = from_buffer<g1::affine_element>(data, i * 64);
+    }
+    return points;
+}
+
+g2::affine_element get_bn254_g2_data(const std::filesystem::path& path)
+{
+    std::filesystem::create_directories(path);
+
+    auto g2_path = path / "bn254_g2.dat";
+    size_t g2_file_size = get_file_size(g2_path);
+
+    if (g2_file_size == 128) {
+        auto data = read_file(g2_path);
+        return from_buffer<g2::affine_element>(data.data());
+    }
+
+    auto data = download_bn254_g2_data();
+    write_file(g2_path, data);
+    return from_buffer<g2::affine_element>(data.data());
+}
+
+std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> get_bn254_prover_crs(const std::filesystem::path& path,
+                                                                               size_t num_points,
+                                                                               const Bn254CrsOptions& options)
+{
+    std::filesystem::create_directories(path);
+
+    return srs::load_or_create_point_table<curve::BN254>(
+        srs::point_table_cache_path(path, curve::BN254::name),
+        num_points,
+        [&]() -> std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> {
+            if (options.mmap_g1_data) {
+                return get_bn254_prover_crs_mapped(path, num_points);
+            }
+            return std::make_shared<srs::factories::MemProverCrs<curve::BN254>>(get_bn254_g1_data(path, num_points));
+        },
+        options.write_point_table,
+        options.verify_point_table);
+}
+
+std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> extend_bn254_prover_crs(
+    const std::filesystem::path& path,
+    std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> prover_crs,
+    size_t num_points,
+    const Bn254CrsOptions& options)
+{
+    if (!prover_crs) {
+        return get_bn254_prover_crs(path, num_points, options);
+    }
+    if (prover_crs->get_monomial_size() >= num_points) {
+        return prover_crs;
+    }
+    return srs::load_or_create_point_table<curve::BN254>(
+        srs::point_table_cache_path(path, curve::BN254::name),
+        num_points,
+        [&]() -> std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> {
+            auto file = map_bn254_g1_data(path, num_points);
+            return std::make_shared<srs::factories::MemProverCrs<curve::BN254>>(
+                *prover_crs, num_points, [&](size_t start, std::span<g1::affine_element> points) {
+                    load_bn254_g1_points(file, start, points);
+                });
+        },
+        options.write_point_table,
+        options.verify_point_table);
+}
+} // namespace bb
\ No newline at end of file
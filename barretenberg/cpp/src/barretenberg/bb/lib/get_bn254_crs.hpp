@@ -0,0 +1,43 @@
+#pragma once
+#include "barretenberg/bb/exec_pipe.hpp"
+#include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/bb/log.hpp"
+#include <barretenberg/ecc/curves/bn254/g1.hpp>
+#include <barretenberg/srs/factories/crs_factory.hpp>
+#include <barretenberg/srs/io.hpp>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+
+namespace bb {
+std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points);
+g2::affine_element get_bn254_g2_data(const std::filesystem::path& path);
+
+struct Bn254CrsOptions {
+    // Convert the g1 points in place from a mapping of bn254_g1.dat instead of reading them into memory first
+    bool mmap_g1_data = false;
+    // Write the pippenger point table next to the g1 data when no usable one is cached yet
+    bool write_point_table = false;
+    // Check the checksum of the whole cached point table before using it
+    bool verify_point_table = false;
+};
+
+/**
+ * @brief Get a prover crs of at least num_points points, mapping the cached pippenger point table in path if present
+ * and building it from the g1 data otherwise (caching it if options.write_point_table is set).
+ */
+std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> get_bn254_prover_crs(const std::filesystem::path& path,
+                                                                               size_t num_points,
+                                                                               const Bn254CrsOptions& options = {});
+/**
+ * @brief Get a prover crs of at least num_points points that extends prover_crs (if not null)
+ * @details A cached point table large enough is mapped as by get_bn254_prover_crs. Otherwise the point table of
+ * prover_crs is copied and only the points past it are converted from the g1 data, so a process growing its crs with
+ * the circuits it is sent does not convert the same points again for every larger circuit.
+ */
+std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> extend_bn254_prover_crs(
+    const std::filesystem::path& path,
+    std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> prover_crs,
+    size_t num_points,
+    const Bn254CrsOptions& options = {});
+} // namespace bb
\ No newline at end of file
@@ -0,0 +1,328 @@
+#include "server.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
+#include "barretenberg/messaging/stream_parser.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+#include "get_bn254_crs.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace bb::server {
+
+namespace {
+
+bool read_exact(int fd, uint8_t* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t num_read = ::read(fd, data, size);
+        if (num_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (num_read <= 0) {
+            return false;
+        }
+        data += num_read;
+        size -= static_cast<size_t>(num_read);
+    }
+    return true;
+}
+
+void write_all(int fd, const char* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t num_written = ::write(fd, data, size);
+        if (num_written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (num_written <= 0) {
+            throw_or_abort(std::string("bb server: write failed: ") + std::strerror(errno));
+        }
+        data += num_written;
+        size -= static_cast<size_t>(num_written);
+    }
+}
+
+/**
+ * @brief Length-prefixed msgpack frames over a pair of file descriptors; the output stream of the StreamDispatcher
+ */
+class FrameStream {
+  public:
+    FrameStream(int input_fd, int output_fd)
+        : input_fd(input_fd)
+        , output_fd(output_fd)
+    {}
+
+    bool receive(std::vector<uint8_t>& frame)
+    {
+        std::array<uint8_t, 4> length_bytes{};
+        if (!read_exact(input_fd, length_bytes.data(), length_bytes.size())) {
+            return false;
+        }
+        const uint32_t length = static_cast<uint32_t>(length_bytes[0]) | (static_cast<uint32_t>(length_bytes[1]) << 8) |
+                                (static_cast<uint32_t>(length_bytes[2]) << 16) |
+                                (static_cast<uint32_t>(length_bytes[3]) << 24);
+        frame.resize(length);
+        return read_exact(input_fd, frame.data(), length);
+    }
+
+    template <typename T> void send(const T& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        const auto length = static_cast<uint32_t>(buffer.size());
+        const std::array<char, 4> length_bytes = { static_cast<char>(length & 0xff),
+                                                   static_cast<char>((length >> 8) & 0xff),
+                                                   static_cast<char>((length >> 16) & 0xff),
+                                                   static_cast<char>((length >> 24) & 0xff) };
+        write_all(output_fd, length_bytes.data(), length_bytes.size());
+        write_all(output_fd, buffer.data(), buffer.size());
+    }
+
+  private:
+    int input_fd;
+    int output_fd;
+};
+
+/**
+ * @brief Wrap a request handler: decode the request, serve it and send the response, or a REQUEST_FAILED message
+ */
+template <typename Request, typename Response>
+std::function<bool(msgpack::object&)> make_handler(FrameStream& stream,
+                                                   ProverService& service,
+                                                   ServerMessageType type,
+                                                   std::function<Response(const Request&)> serve)
+{
+    return [&stream, &service, type, serve = std::move(serve)](msgpack::object& obj) {
+        HeaderOnlyMessage header_only;
+        obj.convert(header_only);
+        service.count_request();
+        MsgHeader header(header_only.header.messageId);
+        try {
+            TypedMessage<Request> request;
+            obj.convert(request);
+            TypedMessage<Response> response(type, header, serve(request.value));
+            stream.send(response);
+        } catch (const std::exception& e) {
+            info("bb server: request ", header_only.header.messageId, " failed: ", e.what());
+            TypedMessage<ErrorResponse> response(REQUEST_FAILED, header, { e.what() });
+            stream.send(response);
+        }
+        return true;
+    };
+}
+
+int serve_socket(const std::string& socket_path, ProverService& service)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw_or_abort("bb server: socket path too long: " + socket_path);
+    }
+    std::copy(socket_path.begin(), socket_path.end(), address.sun_path);
+
+    const int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        throw_or_abort(std::string("bb server: socket failed: ") + std::strerror(errno));
+    }
+    // Remove a socket file left behind by a previous server
+    ::unlink(socket_path.c_str());
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (::bind(listen_fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listen_fd, SOMAXCONN) != 0) {
+        ::close(listen_fd);
+        throw_or_abort("bb server: cannot listen on " + socket_path + ": " + std::strerror(errno));
+    }
+    vinfo("bb server listening on ", socket_path);
+
+    bool running = true;
+    while (running) {
+        const int connection_fd = ::accept(listen_fd, nullptr, nullptr);
+        if (connection_fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        running = serve_connection(connection_fd, connection_fd, service);
+        ::close(connection_fd);
+    }
+    ::close(listen_fd);
+    ::unlink(socket_path.c_str());
+    return running ? 1 : 0;
+}
+
+} // namespace
+
+bool serve_connection(int input_fd, int output_fd, ProverService& service)
+{
+    FrameStream stream(input_fd, output_fd);
+    StreamDispatcher<FrameStream> dispatcher(stream);
+
+    auto prove = make_handler<ProveRequest, ProveResponse>(
+        stream, service, PROVE_ULTRA_HONK, [&service](const ProveRequest& request) {
+            return ProveResponse{ service.prove_ultra_honk(request.bytecode, request.witness) };
+        });
+    auto write_vk = make_handler<WriteVkRequest, WriteVkResponse>(
+        stream, service, WRITE_VK_ULTRA_HONK, [&service](const WriteVkRequest& request) {
+            return WriteVkResponse{ service.write_vk_ultra_honk(request.bytecode) };
+        });
+    auto verify = make_handler<VerifyRequest, VerifyResponse>(
+        stream, service, VERIFY_ULTRA_HONK, [&service](const VerifyRequest& request) {
+            return VerifyResponse{ service.verify_ultra_honk(request.proof, request.vk) };
+        });
+    std::function<bool(msgpack::object&)> get_stats = [&stream, &service](msgpack::object& obj) {
+        HeaderOnlyMessage request;
+        obj.convert(request);
+        service.count_request();
+        MsgHeader header(request.header.messageId);
+        TypedMessage<StatsResponse> response(GET_STATS, header, service.get_stats());
+        stream.send(response);
+        return true;
+    };
+    // The dispatcher only logs messages it has no handler for, so track the served types to answer the others here
+    std::unordered_set<uint32_t> served_types;
+    auto serve = [&](ServerMessageType type, std::function<bool(msgpack::object&)>& handler) {
+        dispatcher.registerTarget(type, handler);
+        served_types.insert(type);
+    };
+    serve(PROVE_ULTRA_HONK, prove);
+    serve(WRITE_VK_ULTRA_HONK, write_vk);
+    serve(VERIFY_ULTRA_HONK, verify);
+    serve(GET_STATS, get_stats);
+
+    std::vector<uint8_t> frame;
+    while (stream.receive(frame)) {
+        try {
+            msgpack::object_handle handle = msgpack::unpack(reinterpret_cast<const char*>(frame.data()), frame.size());
+            msgpack::object obj = handle.get();
+            HeaderOnlyMessage request;
+            obj.convert(request);
+            if (request.msgType >= FIRST_APP_MSG_TYPE && !served_types.contains(request.msgType)) {
+                service.count_request();
+                MsgHeader header(request.header.messageId);
+                TypedMessage<ErrorResponse> response(
+                    REQUEST_FAILED, header, { "unknown message type " + std::to_string(request.msgType) });
+                stream.send(response);
+                continue;
+            }
+            if (!dispatcher.onNewData(obj)) {
+                return false;
+            }
+        } catch (const std::exception& e) {
+            // Without a readable header there is no request to answer
+            info("bb server: dropping malformed message: ", e.what());
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<ProverService::Circuit> ProverService::get_circuit(const std::vector<uint8_t>& bytecode)
+{
+    const auto hash = crypto::sha256(bytecode);
+    const std::string key(hash.begin(), hash.end());
+    if (auto it = circuit_index.find(key); it != circuit_index.end()) {
+        stats.cache_hits++;
+        circuits.splice(circuits.begin(), circuits, it->second);
+        return it->second->second;
+    }
+    stats.cache_misses++;
+    auto circuit = std::make_shared<Circuit>();
+    circuit->constraint_system = acir_format::circuit_buf_to_acir_format(bytecode, /*honk_recursion=*/true);
+    circuits.emplace_front(key, circuit);
+    circuit_index[key] = circuits.begin();
+    while (circuits.size() > std::max<size_t>(cache_capacity, 1)) {
+        circuit_index.erase(circuits.back().first);
+        circuits.pop_back();
+    }
+    return circuit;
+}
+
+void ProverService::ensure_crs(size_t num_points)
+{
+    if (num_points <= crs_size) {
+        return;
+    }
+    vinfo("bb server: growing the CRS from ", crs_size, " to ", num_points, " points");
+    prover_crs = extend_bn254_prover_crs(crs_path, prover_crs, num_points, crs_options);
+    srs::init_crs_factory(prover_crs, get_bn254_g2_data(crs_path));
+    crs_size = prover_crs->get_monomial_size();
+}
+
+std::vector<uint8_t> ProverService::prove_ultra_honk(const std::vector<uint8_t>& bytecode,
+                                                     const std::vector<uint8_t>& witness_buf)
+{
+    auto circuit = get_circuit(bytecode);
+    // Circuit construction may update the constraint system, keep the cached one pristine
+    auto constraint_system = circuit->constraint_system;
+    auto witness = acir_format::witness_buf_to_witness_data(witness_buf);
+    auto builder =
+        acir_format::create_circuit<UltraCircuitBuilder>(constraint_system, 0, witness, /*honk_recursion=*/true);
+
+    auto proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder);
+    ensure_crs(proving_key->proving_key.circuit_size + 1);
+    UltraProver_<Flavor> prover(proving_key);
+    auto proof = prover.construct_proof();
+    return to_buffer</*include_size=*/true>(proof);
+}
+
+std::vector<uint8_t> ProverService::write_vk_ultra_honk(const std::vector<uint8_t>& bytecode)
+{
+    auto circuit = get_circuit(bytecode);
+    if (!circuit->vk) {
+        auto constraint_system = circuit->constraint_system;
+        auto builder =
+            acir_format::create_circuit<UltraCircuitBuilder>(constraint_system, 0, {}, /*honk_recursion=*/true);
+        DeciderProvingKey_<Flavor> proving_key(builder);
+        ensure_crs(proving_key.proving_key.circuit_size + 1);
+        circuit->vk = std::make_shared<VerificationKey>(proving_key.proving_key);
+    }
+    return to_buffer(*circuit->vk);
+}
+
+bool ProverService::verify_ultra_honk(const std::vector<uint8_t>& proof_buf, const std::vector<uint8_t>& vk_buf)
+{
+    // Verification only needs the g2 point, which comes with any CRS
+    ensure_crs(1);
+    auto proof = from_buffer<std::vector<bb::fr>>(proof_buf);
+    auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(vk_buf));
+    vk->pcs_verification_key = std::make_shared<VerifierCommitmentKey<curve::BN254>>();
+    UltraVerifier_<Flavor> verifier{ vk };
+    return verifier.verify_proof(proof);
+}
+
+StatsResponse ProverService::get_stats() const
+{
+    StatsResponse result = stats;
+    result.cached_circuits = circuits.size();
+    result.crs_size = crs_size;
+    return result;
+}
+
+int run_server(const ServerOptions& options)
+{
+    // A client going away must not kill the server
+    std::signal(SIGPIPE, SIG_IGN);
+    ProverService service(options.crs_path, options.crs_options, options.cache_capacity);
+    if (!options.socket_path.empty()) {
+        return serve_socket(options.socket_path, service);
+    }
+    serve_connection(STDIN_FILENO, STDOUT_FILENO, service);
+    return 0;
+}
+
+} // namespace bb::server
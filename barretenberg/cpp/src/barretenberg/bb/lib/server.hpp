@@ -0,0 +1,156 @@
+#pragma once
+#include "barretenberg/bb/lib/get_bn254_crs.hpp"
+#include "barretenberg/dsl/acir_format/acir_format.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * `bb server`: a long-lived prover process.
+ *
+ * Requests and responses are msgpack messages (messaging/header.hpp) framed by a 4 byte little-endian length, read from
+ * stdin and written to stdout, or exchanged over a Unix socket with --socket <path> (one connection at a time). Each
+ * response carries the messageId of its request as requestId. A failed request, or one of a type the server does not
+ * serve, is answered with a REQUEST_FAILED message.
+ *
+ * Compared to one `bb` invocation per proof, the server keeps:
+ * - the CRS and its pippenger point tables loaded, only growing them when a larger circuit comes in;
+ * - an LRU cache of circuits keyed by the sha256 of their bytecode, holding the parsed constraint system and, once
+ *   computed, the verification key.
+ * Circuit construction and the proving key are redone for every proof, as the execution trace of an ACIR circuit
+ * depends on its witness (e.g. through RAM/ROM sorting).
+ */
+namespace bb::server {
+
+using namespace bb::messaging;
+
+enum ServerMessageType {
+    PROVE_ULTRA_HONK = FIRST_APP_MSG_TYPE,
+    WRITE_VK_ULTRA_HONK,
+    VERIFY_ULTRA_HONK,
+    GET_STATS,
+
+    REQUEST_FAILED = 999,
+};
+
+struct ProveRequest {
+    std::vector<uint8_t> bytecode;
+    std::vector<uint8_t> witness;
+    MSGPACK_FIELDS(bytecode, witness);
+};
+
+struct ProveResponse {
+    // As written by `bb prove_ultra_honk`
+    std::vector<uint8_t> proof;
+    MSGPACK_FIELDS(proof);
+};
+
+struct WriteVkRequest {
+    std::vector<uint8_t> bytecode;
+    MSGPACK_FIELDS(bytecode);
+};
+
+struct WriteVkResponse {
+    // As written by `bb write_vk_ultra_honk`
+    std::vector<uint8_t> vk;
+    MSGPACK_FIELDS(vk);
+};
+
+struct VerifyRequest {
+    std::vector<uint8_t> proof;
+    std::vector<uint8_t> vk;
+    MSGPACK_FIELDS(proof, vk);
+};
+
+struct VerifyResponse {
+    bool verified;
+    MSGPACK_FIELDS(verified);
+};
+
+struct StatsResponse {
+    uint64_t num_requests;
+    uint64_t cache_hits;
+    uint64_t cache_misses;
+    uint64_t cached_circuits;
+    uint64_t crs_size;
+    MSGPACK_FIELDS(num_requests, cache_hits, cache_misses, cached_circuits, crs_size);
+};
+
+struct ErrorResponse {
+    std::string message;
+    MSGPACK_FIELDS(message);
+};
+
+/**
+ * @brief The state kept warm by the server and the operations it serves
+ */
+class ProverService {
+  public:
+    using Flavor = UltraFlavor;
+    using VerificationKey = Flavor::VerificationKey;
+
+    ProverService(std::filesystem::path crs_path, Bn254CrsOptions crs_options, size_t cache_capacity)
+        : crs_path(std::move(crs_path))
+        , crs_options(crs_options)
+        , cache_capacity(cache_capacity)
+    {}
+
+    std::vector<uint8_t> prove_ultra_honk(const std::vector<uint8_t>& bytecode, const std::vector<uint8_t>& witness);
+    std::vector<uint8_t> write_vk_ultra_honk(const std::vector<uint8_t>& bytecode);
+    bool verify_ultra_honk(const std::vector<uint8_t>& proof, const std::vector<uint8_t>& vk);
+    StatsResponse get_stats() const;
+
+    void count_request() { stats.num_requests++; }
+
+  private:
+    struct Circuit {
+        acir_format::AcirFormat constraint_system;
+        std::shared_ptr<VerificationKey> vk;
+    };
+
+    std::shared_ptr<Circuit> get_circuit(const std::vector<uint8_t>& bytecode);
+    void ensure_crs(size_t num_points);
+
+    std::filesystem::path crs_path;
+    Bn254CrsOptions crs_options;
+    size_t cache_capacity;
+    // The loaded CRS, extended as larger circuits come in, and its number of points (0 if none is loaded)
+    std::shared_ptr<srs::factories::ProverCrs<curve::BN254>> prover_crs;
+    size_t crs_size = 0;
+
+    // Most recently used first
+    std::list<std::pair<std::string, std::shared_ptr<Circuit>>> circuits;
+    std::unordered_map<std::string, decltype(circuits)::iterator> circuit_index;
+
+    StatsResponse stats{};
+};
+
+struct ServerOptions {
+    std::filesystem::path crs_path;
+    Bn254CrsOptions crs_options;
+    // Serve over this Unix socket rather than stdin/stdout if not empty
+    std::string socket_path;
+    size_t cache_capacity = 8;
+};
+
+/**
+ * @brief Serve the requests of one client until it disconnects
+ * @return false if the client asked the server to terminate
+ */
+bool serve_connection(int input_fd, int output_fd, ProverService& service);
+
+/**
+ * @brief Serve requests until TERMINATE is received or the input is closed (stdin mode), or forever (socket mode)
+ * @return The process exit code
+ */
+int run_server(const ServerOptions& options);
+
+} // namespace bb::server
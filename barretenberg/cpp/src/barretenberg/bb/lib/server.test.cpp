@@ -0,0 +1,150 @@
+#include "server.hpp"
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace bb::server;
+
+namespace {
+
+/**
+ * @brief The client end of a connection to serve_connection, speaking length-prefixed msgpack frames
+ */
+class Client {
+  public:
+    explicit Client(int fd)
+        : fd(fd)
+    {}
+
+    template <typename T> void send(const T& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        const auto length = static_cast<uint32_t>(buffer.size());
+        const std::array<uint8_t, 4> length_bytes = { static_cast<uint8_t>(length & 0xff),
+                                                      static_cast<uint8_t>((length >> 8) & 0xff),
+                                                      static_cast<uint8_t>((length >> 16) & 0xff),
+                                                      static_cast<uint8_t>((length >> 24) & 0xff) };
+        write_all(length_bytes.data(), length_bytes.size());
+        write_all(reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size());
+    }
+
+    template <typename T> T receive()
+    {
+        std::array<uint8_t, 4> length_bytes{};
+        read_all(length_bytes.data(), length_bytes.size());
+        const uint32_t length = static_cast<uint32_t>(length_bytes[0]) | (static_cast<uint32_t>(length_bytes[1]) << 8) |
+                                (static_cast<uint32_t>(length_bytes[2]) << 16) |
+                                (static_cast<uint32_t>(length_bytes[3]) << 24);
+        std::vector<uint8_t> frame(length);
+        read_all(frame.data(), frame.size());
+        msgpack::object_handle handle = msgpack::unpack(reinterpret_cast<const char*>(frame.data()), frame.size());
+        T message;
+        handle.get().convert(message);
+        return message;
+    }
+
+  private:
+    int fd;
+
+    void write_all(const uint8_t* data, size_t size)
+    {
+        while (size > 0) {
+            const ssize_t num_written = ::write(fd, data, size);
+            ASSERT_GT(num_written, 0);
+            data += num_written;
+            size -= static_cast<size_t>(num_written);
+        }
+    }
+
+    void read_all(uint8_t* data, size_t size)
+    {
+        while (size > 0) {
+            const ssize_t num_read = ::read(fd, data, size);
+            ASSERT_GT(num_read, 0);
+            data += num_read;
+            size -= static_cast<size_t>(num_read);
+        }
+    }
+};
+
+} // namespace
+
+class ServerTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds.data()), 0);
+        // None of the requests below need the CRS
+        server = std::thread([this]() { keep_serving = serve_connection(fds[1], fds[1], service); });
+    }
+
+    void TearDown() override
+    {
+        if (server.joinable()) {
+            ::shutdown(fds[0], SHUT_RDWR);
+            server.join();
+        }
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+
+    std::array<int, 2> fds{};
+    ProverService service{ "", {}, 8 };
+    std::thread server;
+    bool keep_serving = true;
+};
+
+TEST_F(ServerTest, AnswersEveryRequestWithItsMessageId)
+{
+    Client client(fds[0]);
+
+    MsgHeader stats_header(1, 0);
+    client.send(HeaderOnlyMessage(GET_STATS, stats_header));
+    auto stats = client.receive<TypedMessage<StatsResponse>>();
+    EXPECT_EQ(stats.msgType, GET_STATS);
+    EXPECT_EQ(stats.header.requestId, 1);
+    EXPECT_EQ(stats.value.num_requests, 1);
+    EXPECT_EQ(stats.value.cached_circuits, 0);
+    EXPECT_EQ(stats.value.crs_size, 0);
+
+    // A prove request whose body is not a ProveRequest
+    MsgHeader failing_header(2, 0);
+    client.send(TypedMessage<std::string>(PROVE_ULTRA_HONK, failing_header, "not a circuit"));
+    auto failure = client.receive<TypedMessage<ErrorResponse>>();
+    EXPECT_EQ(failure.msgType, REQUEST_FAILED);
+    EXPECT_EQ(failure.header.requestId, 2);
+    EXPECT_FALSE(failure.value.message.empty());
+
+    // A message type the server does not know, e.g. from a newer client
+    MsgHeader unknown_header(3, 0);
+    client.send(HeaderOnlyMessage(GET_STATS + 100, unknown_header));
+    auto unknown = client.receive<TypedMessage<ErrorResponse>>();
+    EXPECT_EQ(unknown.msgType, REQUEST_FAILED);
+    EXPECT_EQ(unknown.header.requestId, 3);
+    EXPECT_NE(unknown.value.message.find("unknown message type"), std::string::npos);
+
+    // The server keeps serving after both failures
+    MsgHeader ping_header(4, 0);
+    client.send(HeaderOnlyMessage(PING, ping_header));
+    auto pong = client.receive<HeaderOnlyMessage>();
+    EXPECT_EQ(pong.msgType, PONG);
+    EXPECT_EQ(pong.header.requestId, 4);
+
+    MsgHeader final_stats_header(5, 0);
+    client.send(HeaderOnlyMessage(GET_STATS, final_stats_header));
+    stats = client.receive<TypedMessage<StatsResponse>>();
+    EXPECT_EQ(stats.header.requestId, 5);
+    EXPECT_EQ(stats.value.num_requests, 4);
+    EXPECT_EQ(stats.value.cache_misses, 0);
+
+    MsgHeader terminate_header(6, 0);
+    client.send(HeaderOnlyMessage(TERMINATE, terminate_header));
+    server.join();
+    EXPECT_FALSE(keep_serving);
+}
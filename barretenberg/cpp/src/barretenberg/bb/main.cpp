@@ -1,4 +1,7 @@
 #include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/bb/lib/batch_proofs.hpp"
+#include "barretenberg/bb/lib/get_bn254_crs.hpp"
+#include "barretenberg/bb/lib/server.hpp"
 #include "barretenberg/client_ivc/client_ivc.hpp"
 #include "barretenberg/common/map.hpp"
 #include "barretenberg/common/serialize.hpp"
@@ -8,12 +11,14 @@
 #include "barretenberg/dsl/acir_proofs/honk_contract.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
+#include "barretenberg/polynomials/polynomial_arena.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
 #include "barretenberg/serialize/cbind.hpp"
 #include "barretenberg/stdlib/client_ivc_verifier/client_ivc_recursive_verifier.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+#include "barretenberg/sumcheck/streamed_partial_evaluation.hpp"
 
 #include <cstddef>
 #ifndef DISABLE_AZTEC_VM
@@ -24,7 +29,6 @@
 #include "barretenberg/vm/stats.hpp"
 #endif
 #include "config.hpp"
-#include "get_bn254_crs.hpp"
 #include "get_bytecode.hpp"
 #include "get_grumpkin_crs.hpp"
 #include "libdeflate.h"
@@ -32,10 +36,12 @@
 #include <barretenberg/common/benchmark.hpp>
 #include <barretenberg/common/container.hpp>
 #include <barretenberg/common/log.hpp>
+#include <barretenberg/common/numa.hpp>
 #include <barretenberg/common/timer.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
 #include <barretenberg/srs/global_crs.hpp>
+#include <charconv>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
@@ -52,6 +58,10 @@ std::string getHomeDir()
 }
 
 std::string CRS_PATH = getHomeDir() + "/.bb-crs";
+// Load the g1 points by mapping the CRS file rather than reading it into memory (--crs-mmap), write the pippenger point
+// table next to the CRS when it is not cached yet (--crs-cache or BB_CRS_CACHE=1) and check the checksum of the cached
+// table before using it (--crs-cache-verify).
+Bn254CrsOptions CRS_OPTIONS;
 
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
@@ -64,9 +74,9 @@ const auto current_dir = current_path.filename().string();
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
+    auto bn254_prover_crs = get_bn254_prover_crs(CRS_PATH, dyadic_circuit_size + 1, CRS_OPTIONS);
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    srs::init_crs_factory(bn254_prover_crs, bn254_g2_data);
 }
 
 /**
@@ -1159,6 +1169,50 @@ template <IsUltraFlavor Flavor> bool verify_honk(const std::string& proof_path,
     return verified;
 }
 
+/**
+ * @brief Verifies all the Honk proofs in a directory with a single batched pairing check
+ *
+ * The directory holds proof files named proof or proof_<suffix> (e.g. proof_0, proof_1, ...). The verification key of
+ * proof_<suffix> is read from vk_<suffix> if that file exists and from the shared vk file otherwise; each distinct
+ * verification key is read once. See find_batch_proofs.
+ *
+ * Communication:
+ * - proc_exit: A boolean value is returned indicating whether all proofs are valid.
+ *   an exit code of 0 will be returned for success and 1 for failure.
+ *
+ * @param batch_dir Path to the directory containing the proofs and verification keys
+ * @return true If all proofs are valid
+ * @return false If at least one proof is invalid
+ */
+template <IsUltraFlavor Flavor> bool verify_honk_batch(const std::filesystem::path& batch_dir)
+{
+    using VerificationKey = Flavor::VerificationKey;
+    using Verifier = UltraVerifier_<Flavor>;
+    using VerifierCommitmentKey = bb::VerifierCommitmentKey<curve::BN254>;
+
+    auto g2_data = get_bn254_g2_data(CRS_PATH);
+    srs::init_crs_factory({}, g2_data);
+    auto pcs_verification_key = std::make_shared<VerifierCommitmentKey>();
+
+    std::map<std::filesystem::path, std::shared_ptr<VerificationKey>> vks_by_path;
+    std::vector<std::shared_ptr<VerificationKey>> vks;
+    std::vector<HonkProof> proofs;
+    for (const auto& [proof_path, vk_path] : find_batch_proofs(batch_dir)) {
+        auto& vk = vks_by_path[vk_path];
+        if (!vk) {
+            vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
+            vk->pcs_verification_key = pcs_verification_key;
+        }
+        vks.push_back(vk);
+        proofs.push_back(from_buffer<std::vector<bb::fr>>(read_file(proof_path)));
+    }
+
+    bool verified = Verifier::batch_verify_proofs(vks, proofs);
+
+    vinfo("verified ", proofs.size(), " proofs against ", vks_by_path.size(), " verification keys: ", verified);
+    return verified;
+}
+
 /**
  * @brief Writes a Honk verification key for an ACIR circuit to a file
  *
@@ -1408,6 +1462,25 @@ std::string get_option(std::vector<std::string>& args, const std::string& option
     return (itr != args.end() && std::next(itr) != args.end()) ? *(std::next(itr)) : defaultValue;
 }
 
+/**
+ * @brief Get the value of a numeric option, default_value if it is absent
+ *
+ * @throws std::runtime_error if the value is not a non-negative integer
+ */
+size_t get_size_option(std::vector<std::string>& args, const std::string& option, size_t default_value)
+{
+    const std::string value = get_option(args, option, "");
+    if (value.empty()) {
+        return default_value;
+    }
+    size_t result = 0;
+    const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+    if (ec != std::errc() || end != value.data() + value.size()) {
+        throw std::runtime_error("Invalid value '" + value + "' for " + option + ", expected a non-negative integer");
+    }
+    return result;
+}
+
 int main(int argc, char* argv[])
 {
     try {
@@ -1428,12 +1501,54 @@ int main(int argc, char* argv[])
         std::string pk_path = get_option(args, "-r", "./target/pk");
         bool honk_recursion = flag_present(args, "-h");
         CRS_PATH = get_option(args, "-c", CRS_PATH);
+        CRS_OPTIONS.mmap_g1_data = flag_present(args, "--crs-mmap");
+        const char* crs_cache_env = std::getenv("BB_CRS_CACHE");
+        CRS_OPTIONS.write_point_table =
+            flag_present(args, "--crs-cache") || (crs_cache_env != nullptr && std::string(crs_cache_env) == "1");
+        CRS_OPTIONS.verify_point_table = flag_present(args, "--crs-cache-verify");
+        // Pin the prover threads to NUMA nodes (also enabled by BB_NUMA_PIN=1); must precede any parallel work
+        if (flag_present(args, "--numa-pin")) {
+            numa::set_thread_pinning(true);
+        }
+        vinfo("numa nodes: ", numa::get_topology().num_nodes(), ", thread pinning: ", numa::thread_pinning_enabled());
+        // Serve polynomials from a huge page arena (also enabled by BB_HUGEPAGE_ARENA=1)
+        if (flag_present(args, "--hugepage-arena")) {
+            set_polynomial_arena(std::make_shared<HugePageArena>());
+        }
+        if (std::dynamic_pointer_cast<HugePageArena>(get_polynomial_arena())) {
+            std::atexit([] {
+                if (auto arena = std::dynamic_pointer_cast<HugePageArena>(get_polynomial_arena())) {
+                    auto stats = arena->get_stats();
+                    vinfo("polynomial arena: ",
+                          stats.num_reused,
+                          "/",
+                          stats.num_allocations,
+                          " allocations reused, peak mapped ",
+                          stats.peak_mapped_bytes >> 20,
+                          " MiB, peak rss ",
+                          stats.peak_rss_bytes >> 20,
+                          " MiB");
+                }
+            });
+        }
+        // Bound the memory of the sumcheck book-keeping table, in MiB (also set by BB_SUMCHECK_MEMORY_BUDGET)
+        if (std::string budget = get_option(args, "--sumcheck-memory-budget", ""); !budget.empty()) {
+            set_sumcheck_memory_budget(static_cast<size_t>(std::stoull(budget)) << 20);
+        }
 
         // Skip CRS initialization for any command which doesn't require the CRS.
         if (command == "--version") {
             writeStringToStdout(BB_VERSION);
             return 0;
         }
+        if (command == "server") {
+            // The server loads the CRS itself, growing it with the circuits it is sent
+            server::ServerOptions options{ .crs_path = CRS_PATH,
+                                           .crs_options = CRS_OPTIONS,
+                                           .socket_path = get_option(args, "--socket", ""),
+                                           .cache_capacity = get_size_option(args, "--cache-size", 8) };
+            return server::run_server(options);
+        }
         if (command == "prove_and_verify") {
             return proveAndVerify(bytecode_path, witness_path) ? 0 : 1;
         }
@@ -1547,8 +1662,14 @@ int main(int argc, char* argv[])
             std::string output_path = get_option(args, "-o", "./proofs/proof");
             prove_honk_output_all<UltraKeccakFlavor>(bytecode_path, witness_path, output_path);
         } else if (command == "verify_ultra_honk") {
+            if (std::string batch_dir = get_option(args, "--batch", ""); !batch_dir.empty()) {
+                return verify_honk_batch<UltraFlavor>(batch_dir) ? 0 : 1;
+            }
             return verify_honk<UltraFlavor>(proof_path, vk_path) ? 0 : 1;
         } else if (command == "verify_ultra_keccak_honk") {
+            if (std::string batch_dir = get_option(args, "--batch", ""); !batch_dir.empty()) {
+                return verify_honk_batch<UltraKeccakFlavor>(batch_dir) ? 0 : 1;
+            }
             return verify_honk<UltraKeccakFlavor>(proof_path, vk_path) ? 0 : 1;
         } else if (command == "write_vk_ultra_honk") {
             std::string output_path = get_option(args, "-o", "./target/vk");
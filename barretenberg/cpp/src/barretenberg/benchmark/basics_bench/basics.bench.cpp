@@ -68,6 +68,51 @@ void parallel_for_field_element_addition(State& state)
     }
 }
 
+/**
+ * @brief Benchmark for evaluating the scheduling overhead of parallel_for per chunk
+ *
+ * @details Runs 2^range(0) chunks of a single field addition each, so the time is almost entirely spent splitting,
+ * distributing and waiting for the chunks. The per_chunk counter is the average time per chunk.
+ * @param state
+ */
+void parallel_for_scheduling_overhead(State& state)
+{
+    const size_t num_chunks = 1UL << static_cast<size_t>(state.range(0));
+    std::vector<Fr> elements(num_chunks, Fr::one());
+    for (auto _ : state) {
+        parallel_for(num_chunks, [&elements](size_t index) { elements[index] += elements[index]; });
+    }
+    DoNotOptimize(elements.data());
+    state.counters["per_chunk"] =
+        Counter(static_cast<double>(num_chunks), Counter::kIsIterationInvariantRate | Counter::kInvert);
+}
+
+/**
+ * @brief Same as parallel_for_scheduling_overhead, with the chunks split between an outer and a nested parallel_for
+ *
+ * @details Nested parallel_for calls, e.g. in independent prover tasks which are themselves parallel, are run by the
+ * work-stealing scheduler without oversubscribing the cores.
+ * @param state
+ */
+void nested_parallel_for_scheduling_overhead(State& state)
+{
+    const size_t num_chunks = 1UL << static_cast<size_t>(state.range(0));
+    const size_t num_outer = get_num_cpus();
+    const size_t num_inner = (num_chunks + num_outer - 1) / num_outer;
+    std::vector<Fr> elements(num_outer * num_inner, Fr::one());
+    for (auto _ : state) {
+        parallel_for(num_outer, [&elements, num_inner](size_t outer) {
+            parallel_for(num_inner, [&elements, num_inner, outer](size_t inner) {
+                const size_t index = outer * num_inner + inner;
+                elements[index] += elements[index];
+            });
+        });
+    }
+    DoNotOptimize(elements.data());
+    state.counters["per_chunk"] =
+        Counter(static_cast<double>(num_chunks), Counter::kIsIterationInvariantRate | Counter::kInvert);
+}
+
 /**
  * @brief Evaluate how much finite addition costs (in cache)
  *
@@ -469,6 +514,8 @@ void pippenger(State& state)
 } // namespace
 
 BENCHMARK(parallel_for_field_element_addition)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG);
+BENCHMARK(parallel_for_scheduling_overhead)->Unit(kMicrosecond)->DenseRange(4, 16, 4);
+BENCHMARK(nested_parallel_for_scheduling_overhead)->Unit(kMicrosecond)->DenseRange(4, 16, 4);
 BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
@@ -10,7 +10,9 @@
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
 #include <filesystem>
+#include <fstream>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 using namespace benchmark;
@@ -23,6 +25,46 @@ using Pedersen = ContentAddressedIndexedTree<StoreType, PedersenHashPolicy>;
 
 const size_t TREE_DEPTH = 40;
 const size_t MAX_BATCH_SIZE = 64;
+const size_t NUM_NULLIFIERS = 1024 * 64;
+const size_t INITIAL_TREE_SIZE = 1024;
+
+namespace {
+/**
+ * @brief Read a field of /proc/self/status, in bytes; 0 where it is not available
+ */
+size_t read_proc_status_bytes(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with(field + ":")) {
+            std::istringstream value(line.substr(field.size() + 1));
+            size_t kib = 0;
+            value >> kib;
+            return kib * 1024;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Reset the resident set high-water mark (VmHWM) to the current resident set
+ */
+void reset_peak_rss()
+{
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+
+std::vector<NullifierLeafValue> random_nullifiers(size_t count)
+{
+    std::vector<NullifierLeafValue> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = fr(random_engine.get_random_uint256());
+    }
+    return values;
+}
+} // namespace
 
 template <typename TreeType> void add_values(TreeType& tree, const std::vector<NullifierLeafValue>& values)
 {
@@ -44,6 +86,14 @@ template <typename TreeType> void add_values_with_witness(TreeType& tree, const
     signal.wait_for_level(0);
 }
 
+template <typename TreeType> void rollback(TreeType& tree)
+{
+    Signal signal(1);
+    auto completion = [&](const Response&) -> void { signal.signal_level(0); };
+    tree.rollback(completion);
+    signal.wait_for_level(0);
+}
+
 template <typename TreeType> void multi_thread_indexed_tree_bench(State& state) noexcept
 {
     const size_t batch_size = size_t(state.range(0));
@@ -176,6 +226,72 @@ template <typename TreeType> void single_thread_indexed_tree_with_witness_bench(
     }
 }
 
+/**
+ * @brief Inserts a single batch of 64k nullifiers into the uncommitted state of the tree
+ * @details The batch is rolled back between iterations, so every iteration starts from empty caches. The counters
+ * report the resident set of the process and how far the batch raises it, which is mostly the caches of the store.
+ */
+template <typename TreeType> void nullifier_batch_insert_bench(State& state) noexcept
+{
+    const size_t depth = TREE_DEPTH;
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    uint32_t num_threads = 16;
+
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
+    std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, depth, db);
+    std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(num_threads);
+    TreeType tree = TreeType(std::move(store), workers, INITIAL_TREE_SIZE);
+
+    const size_t rss_before = read_proc_status_bytes("VmRSS");
+    reset_peak_rss();
+    for (auto _ : state) {
+        state.PauseTiming();
+        rollback(tree);
+        std::vector<NullifierLeafValue> values = random_nullifiers(NUM_NULLIFIERS);
+        state.ResumeTiming();
+        add_values(tree, values);
+    }
+    const size_t peak_rss = read_proc_status_bytes("VmHWM");
+    state.counters["peak_rss_MiB"] = static_cast<double>(peak_rss >> 20);
+    state.counters["batch_peak_MiB"] = static_cast<double>((std::max(peak_rss, rss_before) - rss_before) >> 20);
+}
+
+/**
+ * @brief Looks up the low leaf of random keys in a tree holding 64k uncommitted nullifiers
+ * @details With uncommitted data included, every lookup searches the sorted cache of leaf keys as well as the database.
+ */
+template <typename TreeType> void find_low_leaf_bench(State& state) noexcept
+{
+    const size_t depth = TREE_DEPTH;
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    uint32_t num_threads = 1;
+
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
+    std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, depth, db);
+    std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(num_threads);
+    TreeType tree = TreeType(std::move(store), workers, INITIAL_TREE_SIZE);
+
+    add_values(tree, random_nullifiers(NUM_NULLIFIERS));
+
+    std::vector<NullifierLeafValue> keys = random_nullifiers(1024);
+    size_t next_key = 0;
+    for (auto _ : state) {
+        Signal signal(1);
+        auto completion = [&](const TypedResponse<GetLowIndexedLeafResponse>& response) -> void {
+            DoNotOptimize(response.inner.index);
+            signal.signal_level(0);
+        };
+        tree.find_low_leaf(keys[next_key++ % keys.size()].get_key(), true, completion);
+        signal.wait_for_level(0);
+    }
+}
+
 BENCHMARK(single_thread_indexed_tree_with_witness_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -224,4 +340,8 @@ BENCHMARK(multi_thread_indexed_tree_bench<Poseidon2>)
     ->Range(512, 8192)
     ->Iterations(100);
 
+BENCHMARK(nullifier_batch_insert_bench<Poseidon2>)->Unit(benchmark::kMillisecond)->Iterations(5);
+
+BENCHMARK(find_low_leaf_bench<Poseidon2>)->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
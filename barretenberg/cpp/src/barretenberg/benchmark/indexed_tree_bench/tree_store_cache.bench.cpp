@@ -0,0 +1,205 @@
+#include "barretenberg/crypto/merkle_tree/node_store/chunked_sorted_map.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/flat_hash_map.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+
+const size_t TREE_DEPTH = 40;
+const size_t NUM_NULLIFIERS = 1024 * 64;
+
+/**
+ * @brief Read a field of /proc/self/status, in bytes; 0 where it is not available
+ */
+size_t read_proc_status_bytes(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with(field + ":")) {
+            std::istringstream value(line.substr(field.size() + 1));
+            size_t kib = 0;
+            value >> kib;
+            return kib * 1024;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Reset the resident set high-water mark (VmHWM) to the current resident set
+ */
+void reset_peak_rss()
+{
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+
+/**
+ * @brief A fast deterministic stream of field elements standing in for the hashes of the tree
+ */
+class FieldStream {
+  public:
+    fr next() { return fr(uint256_t(next_limb(), next_limb(), next_limb(), next_limb() >> 3)); }
+
+  private:
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+    uint64_t next_limb()
+    {
+        // splitmix64
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+};
+
+// The hash the store uses for field elements, see cached_content_addressed_tree_store.hpp
+struct FieldHash {
+    size_t operator()(const fr& value) const { return static_cast<size_t>(uint256_t(value).data[0]); }
+};
+
+// The values cached by ContentAddressedCachedTreeStore<NullifierLeafValue>, without their serialization
+struct NodePayload {
+    std::optional<fr> left;
+    std::optional<fr> right;
+    uint64_t ref;
+};
+struct LeafPreImage {
+    fr value;
+    fr next_value;
+    uint64_t next_index;
+};
+struct Indices {
+    std::vector<uint64_t> indices;
+};
+
+// The caches of the store before and after they moved to flat containers
+struct StdCaches {
+    std::unordered_map<fr, NodePayload, FieldHash> nodes;
+    std::map<uint256_t, Indices> indices;
+    std::unordered_map<fr, LeafPreImage, FieldHash> leaves;
+    std::vector<std::unordered_map<uint64_t, fr>> nodes_by_index{ TREE_DEPTH + 1 };
+    std::unordered_map<uint64_t, LeafPreImage> leaf_pre_image_by_index;
+
+    const Indices* find_floor(const uint256_t& key) const
+    {
+        auto it = indices.upper_bound(key);
+        return it == indices.begin() ? nullptr : &std::prev(it)->second;
+    }
+};
+
+struct FlatCaches {
+    FlatHashMap<fr, NodePayload, FieldHash> nodes;
+    ChunkedSortedMap<uint256_t, Indices> indices;
+    FlatHashMap<fr, LeafPreImage, FieldHash> leaves;
+    std::vector<FlatHashMap<uint64_t, fr>> nodes_by_index{ TREE_DEPTH + 1 };
+    FlatHashMap<uint64_t, LeafPreImage> leaf_pre_image_by_index;
+
+    const Indices* find_floor(const uint256_t& key) const
+    {
+        const auto* entry = indices.find_floor(key);
+        return entry == nullptr ? nullptr : &entry->second;
+    }
+};
+
+/**
+ * @brief Fills the caches as a batch of nullifier insertions does
+ * @details Each nullifier looks up its low leaf, then caches the pre-images of the new and the updated low leaf, the
+ * key of the new leaf and a new node at every level of the paths of both leaves.
+ */
+template <typename Caches> void insert_nullifiers(Caches& caches, FieldStream& hashes, size_t num_nullifiers)
+{
+    for (uint64_t index = 0; index < num_nullifiers; ++index) {
+        const fr value = hashes.next();
+        const Indices* low_leaf = caches.find_floor(uint256_t(value));
+        const uint64_t low_index = low_leaf == nullptr ? 0 : low_leaf->indices[0];
+        DoNotOptimize(low_index);
+
+        const LeafPreImage new_leaf{ value, hashes.next(), low_index };
+        const LeafPreImage low_leaf_update{ hashes.next(), value, index };
+        caches.leaves[hashes.next()] = new_leaf;
+        caches.leaves[hashes.next()] = low_leaf_update;
+        caches.leaf_pre_image_by_index[index] = new_leaf;
+        caches.leaf_pre_image_by_index[low_index] = low_leaf_update;
+        caches.indices[uint256_t(value)].indices.push_back(index);
+
+        for (uint64_t leaf_index : { index, low_index }) {
+            fr child = hashes.next();
+            for (size_t level = TREE_DEPTH; level > 0; --level) {
+                const fr parent = hashes.next();
+                caches.nodes[parent] = NodePayload{ child, hashes.next(), 1 };
+                caches.nodes_by_index[level - 1][leaf_index >> (TREE_DEPTH - level + 1)] = parent;
+                child = parent;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Caches a batch of 64k nullifiers, from empty caches as after a commit or a rollback
+ */
+template <typename Caches> void nullifier_batch_cache_bench(State& state) noexcept
+{
+    const size_t rss_before = read_proc_status_bytes("VmRSS");
+    reset_peak_rss();
+    for (auto _ : state) {
+        FieldStream hashes;
+        Caches caches;
+        insert_nullifiers(caches, hashes, NUM_NULLIFIERS);
+        state.PauseTiming();
+        DoNotOptimize(caches);
+        {
+            // destroy the caches outside of the timed region
+            Caches released = std::move(caches);
+        }
+        state.ResumeTiming();
+    }
+    const size_t peak_rss = read_proc_status_bytes("VmHWM");
+    state.counters["peak_rss_MiB"] = static_cast<double>(peak_rss >> 20);
+    state.counters["batch_peak_MiB"] = static_cast<double>((std::max(peak_rss, rss_before) - rss_before) >> 20);
+}
+
+/**
+ * @brief Looks up the low leaf of random keys among the keys of 64k cached nullifiers, as find_low_value does
+ */
+template <typename Caches> void find_low_leaf_cache_bench(State& state) noexcept
+{
+    FieldStream hashes;
+    Caches caches;
+    for (uint64_t index = 0; index < NUM_NULLIFIERS; ++index) {
+        caches.indices[uint256_t(hashes.next())].indices.push_back(index);
+    }
+    std::vector<uint256_t> keys(1024);
+    for (auto& key : keys) {
+        key = uint256_t(hashes.next());
+    }
+    size_t next_key = 0;
+    for (auto _ : state) {
+        DoNotOptimize(caches.find_floor(keys[next_key++ % keys.size()]));
+    }
+}
+
+} // namespace
+
+BENCHMARK(nullifier_batch_cache_bench<StdCaches>)->Unit(kMillisecond)->Iterations(3);
+BENCHMARK(nullifier_batch_cache_bench<FlatCaches>)->Unit(kMillisecond)->Iterations(3);
+BENCHMARK(find_low_leaf_cache_bench<StdCaches>)->Unit(kNanosecond);
+BENCHMARK(find_low_leaf_cache_bench<FlatCaches>)->Unit(kNanosecond);
+
+BENCHMARK_MAIN();
@@ -66,6 +66,50 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+constexpr size_t BATCH_POLYNOMIAL_DEGREE_LOG2 = 14;
+constexpr size_t MAX_BATCH_SIZE = 256;
+std::vector<std::shared_ptr<NativeTranscript>> batch_prover_transcripts;
+std::vector<OpeningClaim<Curve>> batch_opening_claims;
+static void DoBatchSetup(const benchmark::State& state)
+{
+    DoSetup(state);
+    if (!batch_prover_transcripts.empty()) {
+        return;
+    }
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t n = 1 << BATCH_POLYNOMIAL_DEGREE_LOG2;
+    for (size_t i = 0; i < MAX_BATCH_SIZE; ++i) {
+        Polynomial poly = Polynomial::random(n);
+        auto x = Fr::random_element(&engine);
+        const OpeningPair<Curve> opening_pair = { x, poly.evaluate(x) };
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA<Curve>::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        batch_prover_transcripts.push_back(prover_transcript);
+        batch_opening_claims.push_back({ opening_pair, ck->commit(poly) });
+    }
+}
+/**
+ * @brief Verify a batch of proofs with IPA::batch_verify, reporting the amortized time per proof
+ */
+void ipa_batch_verify(State& state) noexcept
+{
+    const auto num_proofs = static_cast<size_t>(state.range(0));
+    std::span<const OpeningClaim<Curve>> opening_claims(batch_opening_claims.data(), num_proofs);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (size_t i = 0; i < num_proofs; ++i) {
+            verifier_transcripts.push_back(
+                std::make_shared<NativeTranscript>(batch_prover_transcripts[i]->proof_data));
+        }
+        state.ResumeTiming();
+        auto result = IPA<Curve>::batch_verify(vk, opening_claims, verifier_transcripts);
+        ASSERT(result);
+    }
+    state.counters["per_proof"] = Counter(
+        static_cast<double>(num_proofs), Counter::kIsIterationInvariantRate | Counter::kInvert, Counter::kIs1000);
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +119,5 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_batch_verify)->Unit(kMillisecond)->Arg(1)->Arg(16)->Arg(MAX_BATCH_SIZE)->Setup(DoBatchSetup);
 BENCHMARK_MAIN();
\ No newline at end of file
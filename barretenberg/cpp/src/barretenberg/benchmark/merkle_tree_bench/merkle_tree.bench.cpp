@@ -33,6 +33,40 @@ void hash(State& state) noexcept
 }
 BENCHMARK(hash)->MinTime(5);
 
+/**
+ * @brief Hash the 2^k parents of a level of a Poseidon2 tree one node at a time
+ */
+void poseidon2_hash_level(State& state) noexcept
+{
+    const auto num_nodes = static_cast<size_t>(state.range(0));
+    std::vector<fr> children(VALUES.begin(), VALUES.begin() + static_cast<std::ptrdiff_t>(2 * num_nodes));
+    std::vector<fr> parents(num_nodes);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_nodes; ++i) {
+            parents[i] = Poseidon2HashPolicy::hash_pair(children[2 * i], children[2 * i + 1]);
+        }
+        DoNotOptimize(parents);
+    }
+    state.counters["node_hashes"] = Counter(static_cast<double>(num_nodes), Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(poseidon2_hash_level)->RangeMultiplier(4)->Range(4, MAX / 2);
+
+/**
+ * @brief The same level hashed with the interleaved multi-lane kernel
+ */
+void poseidon2_hash_level_batched(State& state) noexcept
+{
+    const auto num_nodes = static_cast<size_t>(state.range(0));
+    std::vector<fr> children(VALUES.begin(), VALUES.begin() + static_cast<std::ptrdiff_t>(2 * num_nodes));
+    std::vector<fr> parents(num_nodes);
+    for (auto _ : state) {
+        Poseidon2HashPolicy::hash_pairs(children, parents);
+        DoNotOptimize(parents);
+    }
+    state.counters["node_hashes"] = Counter(static_cast<double>(num_nodes), Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(poseidon2_hash_level_batched)->RangeMultiplier(4)->Range(4, MAX / 2);
+
 void update_first_element(State& state) noexcept
 {
     MemoryStore store;
@@ -0,0 +1,81 @@
+#include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+constexpr size_t MAX_NUM_PAIRS = 256;
+
+std::vector<g1::affine_element> points;
+std::vector<pairing::miller_lines> lines;
+static void DoSetup(const benchmark::State&)
+{
+    if (!points.empty()) {
+        return;
+    }
+    points.resize(MAX_NUM_PAIRS);
+    lines.resize(MAX_NUM_PAIRS);
+    for (size_t i = 0; i < MAX_NUM_PAIRS; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+        pairing::precompute_miller_lines(g2::element(g2::affine_element(g2::element::random_element())), lines[i]);
+    }
+}
+
+/**
+ * @brief A product of pairings with precomputed lines, with the Miller loop split across threads
+ */
+void reduced_ate_pairing_batch_precomputed(State& state) noexcept
+{
+    const auto num_pairs = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        DoNotOptimize(pairing::reduced_ate_pairing_batch_precomputed(&points[0], &lines[0], num_pairs));
+    }
+}
+
+/**
+ * @brief The same product on a single thread, for reference
+ */
+void reduced_ate_pairing_batch_precomputed_serial(State& state) noexcept
+{
+    const auto num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<g1::element> jacobian_points(points.begin(), points.begin() + static_cast<std::ptrdiff_t>(num_pairs));
+    for (auto _ : state) {
+        fq12 result = pairing::miller_loop_batch(&jacobian_points[0], &lines[0], num_pairs);
+        result = pairing::final_exponentiation_easy_part(result);
+        DoNotOptimize(pairing::final_exponentiation_tricky_part(result));
+    }
+}
+
+void final_exponentiation(State& state) noexcept
+{
+    fq12 elt = fq12::random_element();
+    for (auto _ : state) {
+        fq12 result = pairing::final_exponentiation_easy_part(elt);
+        DoNotOptimize(pairing::final_exponentiation_tricky_part(result));
+    }
+}
+
+void cyclotomic_squared(State& state) noexcept
+{
+    fq12 elt = pairing::final_exponentiation_easy_part(fq12::random_element());
+    for (auto _ : state) {
+        elt = elt.cyclotomic_squared();
+        DoNotOptimize(elt);
+    }
+}
+} // namespace
+
+BENCHMARK(reduced_ate_pairing_batch_precomputed)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(2, MAX_NUM_PAIRS)
+    ->Setup(DoSetup);
+BENCHMARK(reduced_ate_pairing_batch_precomputed_serial)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(2, MAX_NUM_PAIRS)
+    ->Setup(DoSetup);
+BENCHMARK(final_exponentiation)->Unit(kMicrosecond);
+BENCHMARK(cyclotomic_squared)->Unit(kNanosecond);
+BENCHMARK_MAIN();
@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
@@ -82,6 +83,61 @@ int pippenger()
     return 0;
 }
 
+/**
+ * @brief Compare pippenger against the fixed-base MSM for repeated commitments to the same SRS prefix, for sizes
+ * 2^16 to 2^22. The one-off fixed-base precomputation is reported separately.
+ */
+int fixed_base_vs_pippenger()
+{
+    using FixedBaseMsm = scalar_multiplication::FixedBaseMsm<curve::BN254>;
+    constexpr size_t MIN_LOG_SIZE = 16;
+    constexpr size_t MAX_LOG_SIZE = 22;
+    constexpr int64_t NUM_REPETITIONS = 3;
+
+    auto crs = std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(1UL << MAX_LOG_SIZE,
+                                                                                 "../srs_db/ignition");
+    std::vector<fr> random_scalars(1UL << MAX_LOG_SIZE);
+    for (auto& scalar : random_scalars) {
+        scalar = fr::random_element();
+    }
+
+    const auto elapsed_us = [](auto time_start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - time_start)
+            .count();
+    };
+
+    for (size_t log_size = MIN_LOG_SIZE; log_size <= MAX_LOG_SIZE; ++log_size) {
+        const size_t num_points = 1UL << log_size;
+        PolynomialSpan<const fr> span{ 0, { random_scalars.data(), num_points } };
+        // Give the largest sizes enough memory for the biggest window the engine supports
+        const size_t memory_budget =
+            std::max(FixedBaseMsm::DEFAULT_MEMORY_BUDGET, FixedBaseMsm::min_memory_budget(num_points));
+
+        auto time_start = std::chrono::steady_clock::now();
+        FixedBaseMsm fixed_base_msm(crs->get_monomial_points(), num_points, memory_budget);
+        const auto precompute_time = elapsed_us(time_start);
+
+        scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_points);
+        int64_t pippenger_time = 0;
+        int64_t fixed_base_time = 0;
+        for (int64_t i = 0; i < NUM_REPETITIONS; ++i) {
+            time_start = std::chrono::steady_clock::now();
+            g1::affine_element expected = scalar_multiplication::pippenger_unsafe<curve::BN254>(
+                span, crs->get_monomial_points(), state);
+            pippenger_time += elapsed_us(time_start);
+
+            time_start = std::chrono::steady_clock::now();
+            g1::affine_element result = fixed_base_msm.msm(span);
+            fixed_base_time += elapsed_us(time_start);
+            ASSERT(result == expected);
+        }
+        std::cout << "2^" << log_size << ": pippenger " << pippenger_time / NUM_REPETITIONS << "us, fixed-base "
+                  << fixed_base_time / NUM_REPETITIONS << "us (window bits " << fixed_base_msm.get_window_bits()
+                  << ", precompute " << precompute_time << "us)" << std::endl;
+    }
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -117,5 +173,7 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "executing fixed-base msm comparison" << std::endl;
+    fixed_base_vs_pippenger();
     return 0;
 }
@@ -1,6 +1,9 @@
 #include <benchmark/benchmark.h>
+#include <fstream>
+#include <sstream>
 
 #include "barretenberg/protogalaxy/protogalaxy_prover.hpp"
+#include "barretenberg/protogalaxy/protogalaxy_prover_internal.hpp"
 #include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/ultra_honk/decider_keys.hpp"
@@ -11,6 +14,35 @@ namespace bb {
 
 using Flavor = MegaFlavor;
 
+namespace {
+/**
+ * @brief Read a field of /proc/self/status, in bytes; 0 where it is not available
+ */
+size_t read_proc_status_bytes(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with(field + ":")) {
+            std::istringstream value(line.substr(field.size() + 1));
+            size_t kib = 0;
+            value >> kib;
+            return kib * 1024;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Reset the resident set high-water mark (VmHWM) to the current resident set, so that it tracks a single round
+ */
+void reset_peak_rss()
+{
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+}
+} // namespace
+
 void _bench_round(::benchmark::State& state, void (*F)(ProtogalaxyProver_<DeciderProvingKeys_<Flavor, 2>>&))
 {
     using Builder = typename Flavor::CircuitBuilder;
@@ -36,15 +68,20 @@ void _bench_round(::benchmark::State& state, void (*F)(ProtogalaxyProver_<Decide
 
     // prepare the prover state
     folding_prover.accumulator = key_1;
-    folding_prover.deltas.resize(log2_num_gates);
-    std::fill_n(folding_prover.deltas.begin(), log2_num_gates, 0);
+    folding_prover.deltas = compute_round_challenge_pows(CONST_PG_LOG_N, Flavor::FF::random_element());
     folding_prover.perturbator = Flavor::Polynomial::random(1 << log2_num_gates);
     folding_prover.transcript = Flavor::Transcript::prover_init_empty();
     folding_prover.run_oink_prover_on_each_incomplete_key();
 
+    // Report the memory high-water of the round above the resident set of the prover state
+    const size_t rss_before = read_proc_status_bytes("VmRSS");
+    reset_peak_rss();
     for (auto _ : state) {
         F(folding_prover);
     }
+    const size_t peak_rss = read_proc_status_bytes("VmHWM");
+    state.counters["peak_rss_MiB"] = static_cast<double>(peak_rss >> 20);
+    state.counters["round_peak_MiB"] = static_cast<double>((std::max(peak_rss, rss_before) - rss_before) >> 20);
 }
 
 void bench_round_mega(::benchmark::State& state, void (*F)(ProtogalaxyProver_<DeciderProvingKeys_<MegaFlavor, 2>>&))
@@ -54,8 +91,11 @@ void bench_round_mega(::benchmark::State& state, void (*F)(ProtogalaxyProver_<De
 
 BENCHMARK_CAPTURE(bench_round_mega, oink, [](auto& prover) { prover.run_oink_prover_on_each_incomplete_key(); })
     -> DenseRange(14, 20) -> Unit(kMillisecond);
-BENCHMARK_CAPTURE(bench_round_mega, perturbator, [](auto& prover) { prover.perturbator_round(prover.accumulator); })
-    -> DenseRange(14, 20) -> Unit(kMillisecond);
+// The first key is not an accumulator, for which perturbator_round would skip the perturbator, so compute it directly
+BENCHMARK_CAPTURE(bench_round_mega, perturbator, [](auto& prover) {
+    using Fun = ProtogalaxyProverInternal<DeciderProvingKeys_<MegaFlavor, 2>>;
+    DoNotOptimize(Fun::compute_perturbator(prover.accumulator, prover.deltas));
+}) -> DenseRange(14, 20) -> Unit(kMillisecond);
 BENCHMARK_CAPTURE(bench_round_mega, combiner_quotient, [](auto& prover) {
     prover.combiner_quotient_round(prover.accumulator->gate_challenges, prover.deltas, prover.keys_to_fold);
 }) -> DenseRange(14, 20) -> Unit(kMillisecond);
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#ifndef DISABLE_AZTEC_VM
+#include "barretenberg/honk/proof_system/logderivative_library.hpp"
+#include "barretenberg/vm/avm/generated/flavor.hpp"
+
+using namespace benchmark;
+
+namespace bb::benchmark::logderivative_inverse {
+
+using Flavor = AvmFlavor;
+using FF = Flavor::FF;
+
+constexpr size_t NUM_ROWS = 1 << 20;
+
+/**
+ * @brief Computes the inverse polynomial of one AVM lookup or permutation over 2^20 rows, a quarter of them active
+ * @details Only the columns the relation reads are allocated: the full AVM trace at this size would not fit in memory.
+ */
+template <typename Settings, typename Relation> void compute_inverse(State& state)
+{
+    Flavor::ProverPolynomials polynomials;
+    std::apply(
+        [&](auto&... columns) {
+            ((columns = Polynomial<FF>(NUM_ROWS)), ...);
+            for (size_t i = 0; i < NUM_ROWS; i += 4) {
+                ((columns.at(i) = 1), ...);
+            }
+        },
+        Settings::get_nonconst_entities(polynomials));
+    auto params = RelationParameters<FF>::get_random();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Relation::get_inverse_polynomial(polynomials) = Polynomial<FF>(NUM_ROWS);
+        state.ResumeTiming();
+        compute_logderivative_inverse<Flavor, Relation>(polynomials, params, NUM_ROWS);
+    }
+}
+
+BENCHMARK(compute_inverse<lookup_rng_chk_0_lookup_settings, lookup_rng_chk_0_relation<FF>>)->Unit(kMillisecond);
+BENCHMARK(compute_inverse<lookup_byte_operations_lookup_settings, lookup_byte_operations_relation<FF>>)
+    ->Unit(kMillisecond);
+BENCHMARK(compute_inverse<lookup_opcode_gas_lookup_settings, lookup_opcode_gas_relation<FF>>)->Unit(kMillisecond);
+BENCHMARK(compute_inverse<perm_main_alu_permutation_settings, perm_main_alu_relation<FF>>)->Unit(kMillisecond);
+
+} // namespace bb::benchmark::logderivative_inverse
+#endif // DISABLE_AZTEC_VM
+
+BENCHMARK_MAIN();
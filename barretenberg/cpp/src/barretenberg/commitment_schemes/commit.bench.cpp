@@ -81,6 +81,46 @@ template <typename FF> PolyData<FF> structured_random_poly(bool non_zero_complem
     return { polynomial, active_range_endpoints };
 }
 
+// Generate a selector-like polynomial for a structured trace (block sizes of TraceStructure::E2E_FULL_TEST): equal to 1
+// on the active rows of one block (or to small values, if indicated, mimicking e.g. q_c) and zero elsewhere
+template <typename FF> Polynomial<FF> structured_selector_poly(bool small_values = false)
+{
+    std::vector<uint32_t> fixed_sizes = {
+        1 << 10, 4000, 200000, 25000, 80000, 100000, 200000, 6000, 30000, 150000,
+    };
+    std::vector<uint32_t> actual_sizes = {
+        10, 16, 48873, 18209, 4132, 23556, 35443, 3, 2, 2,
+    };
+    const size_t selected_block = 2; // arithmetic
+
+    uint32_t full_size = 0;
+    for (auto size : fixed_sizes) {
+        full_size += size;
+    }
+    auto polynomial = Polynomial<FF>(numeric::round_up_power_2(full_size));
+
+    auto& engine = numeric::get_debug_randomness();
+    uint32_t start_idx = 0;
+    for (size_t block_idx = 0; block_idx < fixed_sizes.size(); ++block_idx) {
+        if (block_idx == selected_block) {
+            for (size_t i = start_idx; i < start_idx + actual_sizes[block_idx]; ++i) {
+                polynomial.at(i) = small_values ? FF(engine.get_random_uint32()) : FF(1);
+            }
+        }
+        start_idx += fixed_sizes[block_idx];
+    }
+    return polynomial;
+}
+
+// Commit to a polynomial directly with pippenger, bypassing the sparse front-end of CommitmentKey::commit
+template <typename Curve>
+typename Curve::AffineElement commit_pippenger(CommitmentKey<Curve>& key,
+                                               const Polynomial<typename Curve::ScalarField>& polynomial)
+{
+    return scalar_multiplication::pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(
+        polynomial, key.srs->get_monomial_points(), key.pippenger_runtime_state);
+}
+
 constexpr size_t MIN_LOG_NUM_POINTS = 16;
 constexpr size_t MAX_LOG_NUM_POINTS = 20;
 constexpr size_t MAX_NUM_POINTS = 1 << MAX_LOG_NUM_POINTS;
@@ -208,6 +248,19 @@ template <typename Curve> void bench_commit_structured_random_poly(::benchmark::
     }
 }
 
+// Commit to a polynomial with block structured random entries using pippenger on the full polynomial
+template <typename Curve> void bench_commit_structured_random_poly_pippenger(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    auto [polynomial, active_range_endpoints] = structured_random_poly<Fr>();
+
+    for (auto _ : state) {
+        commit_pippenger(*key, polynomial);
+    }
+}
+
 // Commit to a polynomial with block structured random entries using commit_structured
 template <typename Curve> void bench_commit_structured_random_poly_preprocessed(::benchmark::State& state)
 {
@@ -247,6 +300,33 @@ template <typename Curve> void bench_commit_mock_z_perm_preprocessed(::benchmark
     }
 }
 
+// Commit to a structured-trace selector with the default commit method (sparse front-end); range(0) selects small
+// values rather than ones
+template <typename Curve> void bench_commit_mock_selector(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    auto polynomial = structured_selector_poly<Fr>(/*small_values=*/state.range(0) != 0);
+
+    for (auto _ : state) {
+        key->commit(polynomial);
+    }
+}
+
+// Commit to a structured-trace selector using pippenger on the full polynomial
+template <typename Curve> void bench_commit_mock_selector_pippenger(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    auto polynomial = structured_selector_poly<Fr>(/*small_values=*/state.range(0) != 0);
+
+    for (auto _ : state) {
+        commit_pippenger(*key, polynomial);
+    }
+}
+
 BENCHMARK(bench_commit_zero<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
@@ -269,7 +349,10 @@ BENCHMARK(bench_commit_random_non_power_of_2<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_structured_random_poly<curve::BN254>)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_structured_random_poly_pippenger<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_structured_random_poly_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_mock_selector<curve::BN254>)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_mock_selector_pippenger<curve::BN254>)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
 
@@ -9,9 +9,13 @@
 
 #include "barretenberg/common/debug_log.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/ecc/scalar_multiplication/batched_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/ecc/scalar_multiplication/sorted_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/sparse_msm.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -22,7 +26,9 @@
 
 #include <cstddef>
 #include <memory>
+#include <numeric>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -39,6 +45,7 @@ template <class Curve> class CommitmentKey {
     using Fr = typename Curve::ScalarField;
     using Commitment = typename Curve::AffineElement;
     using G1 = typename Curve::AffineElement;
+    using FixedBaseMsm = scalar_multiplication::FixedBaseMsm<Curve>;
     static constexpr size_t EXTRA_SRS_POINTS_FOR_ECCVM_IPA = 1;
 
     static size_t get_num_needed_srs_points(size_t num_points)
@@ -51,10 +58,34 @@ template <class Curve> class CommitmentKey {
         return numeric::round_up_power_2(num_points) + EXTRA_SRS_POINTS_FOR_ECCVM_IPA;
     }
 
+    // Number of nonzero coefficients of a polynomial, only counted when it could exceed the batch MSM limit
+    static size_t count_nonzero(PolynomialSpan<const Fr> polynomial)
+    {
+        if (polynomial.size() <= scalar_multiplication::BATCH_MSM_MAX_NONZERO_SCALARS) {
+            return polynomial.size();
+        }
+        const size_t num_threads = calculate_num_threads(polynomial.size());
+        const size_t block_size = (polynomial.size() + num_threads - 1) / num_threads;
+        std::vector<size_t> thread_counts(num_threads, 0);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(polynomial.size(), (thread_idx + 1) * block_size);
+            for (size_t idx = start; idx < end; ++idx) {
+                if (!polynomial.span[idx].is_zero()) {
+                    ++thread_counts[thread_idx];
+                }
+            }
+        });
+        return std::accumulate(thread_counts.begin(), thread_counts.end(), size_t(0));
+    }
+
   public:
     scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
     std::shared_ptr<srs::factories::ProverCrs<Curve>> srs;
+    // Precomputed window tables for the fixed-base commitment strategy; null unless precompute_fixed_base_tables is
+    // called
+    std::shared_ptr<FixedBaseMsm> fixed_base_msm;
 
     CommitmentKey() = delete;
 
@@ -86,6 +117,25 @@ template <class Curve> class CommitmentKey {
     Commitment commit(PolynomialSpan<const Fr> polynomial)
     {
         PROFILE_THIS();
+        if (fixed_base_msm && polynomial.end_index() <= fixed_base_msm->get_num_points()) {
+            return commit_fixed_base(polynomial);
+        }
+        // Polynomials made up mostly of zeros, ±1 and small values (selectors, wires of a structured trace) skip the
+        // zeros and take cheaper paths for the ±1 and small values. A sample of the coefficients rules out the dense
+        // ones before paying for a full classification.
+        if (scalar_multiplication::likely_sparse<Curve>(polynomial)) {
+            const auto classification = scalar_multiplication::classify_scalars<Curve>(polynomial);
+            if (classification.is_sparse()) {
+                if (polynomial.end_index() > srs->get_monomial_size()) {
+                    throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                          polynomial.end_index(),
+                                          " points with an SRS of size ",
+                                          srs->get_monomial_size()));
+                }
+                return scalar_multiplication::sparse_msm_unsafe<Curve>(
+                    polynomial, classification, srs->get_monomial_points(), pippenger_runtime_state);
+            }
+        }
         // We must have a power-of-2 SRS points *after* subtracting by start_index.
         size_t dyadic_poly_size = numeric::round_up_power_2(polynomial.size());
         // Because pippenger prefers a power-of-2 size, we must choose a starting index for the points so that we don't
@@ -121,6 +171,92 @@ template <class Curve> class CommitmentKey {
         return point;
     };
 
+    /**
+     * @brief Commit to several polynomials at once
+     * @details The polynomials are committed to together with batch_msm_unsafe, which shares the point table between
+     * the MSMs, skips zero coefficients and schedules the pippenger rounds of all polynomials over the available
+     * threads. This avoids paying the setup and synchronisation of a full pippenger per polynomial when committing to
+     * many small or sparse polynomials (e.g. the wires of a circuit). Polynomials with too many nonzero coefficients
+     * for a single batch MSM, or that are covered by the fixed-base tables, are committed to individually.
+     *
+     * @param polynomials univariate polynomials pⱼ(X) = ∑ᵢ aⱼᵢ⋅Xⁱ
+     * @return Commitments [pⱼ(x)], in the order of the polynomials
+     */
+    std::vector<Commitment> batch_commit(RefSpan<Polynomial<Fr>> polynomials)
+    {
+        PROFILE_THIS();
+        std::vector<Commitment> commitments(polynomials.size());
+        std::vector<size_t> batched_indices;
+        std::vector<PolynomialSpan<const Fr>> batched_polynomials;
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            const PolynomialSpan<const Fr> polynomial = polynomials[i];
+            const bool use_fixed_base = fixed_base_msm && polynomial.end_index() <= fixed_base_msm->get_num_points();
+            if (use_fixed_base || count_nonzero(polynomial) > scalar_multiplication::BATCH_MSM_MAX_NONZERO_SCALARS) {
+                commitments[i] = commit(polynomial);
+                continue;
+            }
+            if (polynomial.end_index() > srs->get_monomial_size()) {
+                throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                      polynomial.end_index(),
+                                      " points with an SRS of size ",
+                                      srs->get_monomial_size()));
+            }
+            batched_indices.push_back(i);
+            batched_polynomials.push_back(polynomial);
+        }
+
+        // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
+        // endomorphism point (\beta*x, -y) at odd indices).
+        std::span<const G1> point_table = srs->get_monomial_points();
+        auto batched_commitments = scalar_multiplication::batch_msm_unsafe<Curve>(point_table, batched_polynomials);
+        for (size_t i = 0; i < batched_indices.size(); ++i) {
+            commitments[batched_indices[i]] = batched_commitments[i];
+        }
+        return commitments;
+    }
+
+    /**
+     * @brief Enable the fixed-base commitment strategy for polynomials supported on the first num_points SRS points
+     * @details Precomputes windowed multiples of the SRS points once so that each subsequent commitment skips the
+     * per-window bucket reductions and doublings of pippenger (see FixedBaseMsm). Worthwhile when many commitments are
+     * made against the same key. Once enabled, commit() uses this strategy whenever the polynomial fits within the
+     * precomputed points.
+     *
+     * @param num_points Number of leading SRS points to precompute
+     * @param memory_budget Maximum size in bytes of the precomputed tables
+     */
+    void precompute_fixed_base_tables(size_t num_points, size_t memory_budget = FixedBaseMsm::DEFAULT_MEMORY_BUDGET)
+    {
+        PROFILE_THIS();
+        if (num_points > srs->get_monomial_size()) {
+            throw_or_abort(format("Attempting to precompute fixed-base tables for ",
+                                  num_points,
+                                  " points with an SRS of size ",
+                                  srs->get_monomial_size()));
+        }
+        fixed_base_msm = std::make_shared<FixedBaseMsm>(srs->get_monomial_points(), num_points, memory_budget);
+    }
+
+    /**
+     * @brief Commit to p(X) using the precomputed fixed-base tables
+     * @details Requires a prior call to precompute_fixed_base_tables covering the polynomial's support.
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit_fixed_base(PolynomialSpan<const Fr> polynomial)
+    {
+        PROFILE_THIS();
+        ASSERT(fixed_base_msm != nullptr);
+        if (polynomial.end_index() > fixed_base_msm->get_num_points()) {
+            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                  polynomial.end_index(),
+                                  " points with fixed-base tables of size ",
+                                  fixed_base_msm->get_num_points()));
+        }
+        return fixed_base_msm->msm(polynomial);
+    }
+
     /**
      * @brief Efficiently commit to a sparse polynomial
      * @details Iterate through the {point, scalar} pairs that define the inputs to the commitment MSM, maintain (copy)
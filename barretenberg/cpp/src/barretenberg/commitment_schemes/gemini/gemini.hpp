@@ -100,6 +100,9 @@ template <typename Curve> class GeminiProver_ {
     using Claim = ProverOpeningClaim<Curve>;
 
   public:
+    // Number of coefficients of A₀ folded together through the first foldings, sized to stay in the L2 cache
+    static constexpr size_t FOLD_TILE_SIZE = 1 << 12;
+
     static std::vector<Polynomial> compute_fold_polynomials(const size_t log_N,
                                                             std::span<const Fr> multilinear_challenge,
                                                             Polynomial&& batched_unshifted,
@@ -95,10 +95,15 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
                                                      std::move(batched_to_be_shifted),
                                                      std::move(batched_concatenated));
 
+    // Commit to the folds together, so that the MSMs of the small ones share the work of the large ones
+    std::vector<Polynomial*> folds;
+    for (size_t l = 2; l < fold_polynomials.size(); l++) {
+        folds.push_back(&fold_polynomials[l]);
+    }
+    const auto fold_commitments = commitment_key->batch_commit(RefVector<Polynomial>(folds));
     for (size_t l = 0; l < CONST_PROOF_SIZE_LOG_N - 1; l++) {
         if (l < log_n - 1) {
-            transcript->send_to_verifier("Gemini:FOLD_" + std::to_string(l + 1),
-                                         commitment_key->commit(fold_polynomials[l + 2]));
+            transcript->send_to_verifier("Gemini:FOLD_" + std::to_string(l + 1), fold_commitments[l]);
         } else {
             transcript->send_to_verifier("Gemini:FOLD_" + std::to_string(l + 1), Commitment::one());
         }
@@ -136,10 +141,6 @@ std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::com
     Polynomial&& batched_to_be_shifted,
     Polynomial&& batched_concatenated)
 {
-    const size_t num_threads = get_num_cpus_pow2();
-    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
-                                                           // would be a point in sending them to a separate thread
-
     // Allocate space for m+1 Fold polynomials
     //
     // The first two are populated here with the batched unshifted and to-be-shifted polynomial respectively.
@@ -151,7 +152,6 @@ std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::com
     // F(X) = ∑ⱼ ρʲ fⱼ(X) and G(X) = ∑ⱼ ρᵏ⁺ʲ gⱼ(X)
     Polynomial& batched_F = fold_polynomials.emplace_back(std::move(batched_unshifted));
     Polynomial& batched_G = fold_polynomials.emplace_back(std::move(batched_to_be_shifted));
-    constexpr size_t offset_to_folded = 2; // Offset because of F an G
     // A₀(X) = F(X) + G↺(X) = F(X) + G(X)/X.
     Polynomial A_0 = batched_F;
 
@@ -160,49 +160,48 @@ std::vector<typename GeminiProver_<Curve>::Polynomial> GeminiProver_<Curve>::com
 
     A_0 += batched_G.shifted();
 
-    // Allocate everything before parallel computation
-    for (size_t l = 0; l < num_variables - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (num_variables - l - 1);
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        fold_polynomials.emplace_back(Polynomial(n_l));
+    // The folds Aₗ, l = 1, ..., m-1, of sizes n/2, n/4, ..., 2, live one after the other in a single buffer of size n
+    const size_t n = static_cast<size_t>(1) << num_variables;
+    Polynomial fold_buffer(n, n, 0, Polynomial::DontZeroMemory::FLAG);
+    std::vector<Fr*> folds(num_variables);
+    folds[0] = A_0.data();
+    for (size_t l = 1; l < num_variables; ++l) {
+        const size_t n_l = n >> l;
+        // A_l_fold = Aₗ(X) = (1-uₗ₋₁)⋅even(Aₗ₋₁)(X) + uₗ₋₁⋅odd(Aₗ₋₁)(X)
+        Polynomial& A_l = fold_polynomials.emplace_back(fold_buffer.share_range(n - 2 * n_l, n_l));
+        folds[l] = A_l.data();
     }
 
-    // A_l = Aₗ(X) is the polynomial being folded
-    // in the first iteration, we take the batched polynomial
-    // in the next iteration, it is the previously folded one
-    auto A_l = A_0.data();
-    for (size_t l = 0; l < num_variables - 1; ++l) {
-        // size of the previous polynomial/2
-        const size_t n_l = 1 << (num_variables - l - 1);
-
-        // Use as many threads as it is useful so that 1 thread doesn't process 1 element, but make sure that there is
-        // at least 1
-        size_t num_used_threads = std::min(n_l / efficient_operations_per_thread, num_threads);
-        num_used_threads = num_used_threads ? num_used_threads : 1;
-        size_t chunk_size = n_l / num_used_threads;
-        size_t last_chunk_size = (n_l % chunk_size) ? (n_l % num_used_threads) : chunk_size;
-
-        // Openning point is the same for all
+    // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
+    //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
+    //            = Aₗ₊₁[j]
+    auto fold = [&](size_t l, size_t start, size_t end) {
         const Fr u_l = mle_opening_point[l];
-
-        // A_l_fold = Aₗ₊₁(X) = (1-uₗ)⋅even(Aₗ)(X) + uₗ⋅odd(Aₗ)(X)
-        auto A_l_fold = fold_polynomials[l + offset_to_folded].data();
-
-        parallel_for(num_used_threads, [&](size_t i) {
-            size_t current_chunk_size = (i == (num_used_threads - 1)) ? last_chunk_size : chunk_size;
-            for (std::ptrdiff_t j = (std::ptrdiff_t)(i * chunk_size);
-                 j < (std::ptrdiff_t)((i * chunk_size) + current_chunk_size);
-                 j++) {
-                // fold(Aₗ)[j] = (1-uₗ)⋅even(Aₗ)[j] + uₗ⋅odd(Aₗ)[j]
-                //            = (1-uₗ)⋅Aₗ[2j]      + uₗ⋅Aₗ[2j+1]
-                //            = Aₗ₊₁[j]
-                A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
+        const Fr* A_l = folds[l];
+        Fr* A_l_fold = folds[l + 1];
+        for (size_t j = start; j < end; ++j) {
+            A_l_fold[j] = A_l[j << 1] + u_l * (A_l[(j << 1) + 1] - A_l[j << 1]);
+        }
+    };
+
+    // Fold A₀ in tiles of FOLD_TILE_SIZE coefficients: each tile goes through the first log(FOLD_TILE_SIZE) foldings
+    // while it is in cache, rather than streaming each fold through memory.
+    const size_t num_tile_levels = std::min(numeric::get_msb(FOLD_TILE_SIZE), num_variables - 1);
+    const size_t tile_size = std::min(FOLD_TILE_SIZE, n);
+    parallel_for_range(n / tile_size, [&](size_t start_tile, size_t end_tile) {
+        for (size_t tile = start_tile; tile < end_tile; ++tile) {
+            for (size_t l = 0; l < num_tile_levels; ++l) {
+                const size_t tile_fold_size = tile_size >> (l + 1);
+                fold(l, tile * tile_fold_size, (tile + 1) * tile_fold_size);
             }
-        });
-        // set Aₗ₊₁ = Aₗ for the next iteration
-        A_l = A_l_fold;
+        }
+    });
+    // The remaining folds are of at most n / FOLD_TILE_SIZE coefficients
+    constexpr size_t efficient_operations_per_thread = 64; // A guess of the number of operation for which there
+                                                           // would be a point in sending them to a separate thread
+    for (size_t l = num_tile_levels; l + 1 < num_variables; ++l) {
+        parallel_for_range(
+            n >> (l + 1), [&](size_t start, size_t end) { fold(l, start, end); }, efficient_operations_per_thread);
     }
 
     return fold_polynomials;
@@ -581,6 +581,159 @@ template <typename Curve_> class IPA {
     {
         return reduce_verify_internal(vk, opening_claim, transcript);
     }
+    /**
+     * @brief Verify many IPA proofs against the same SRS with a single MSM over the SRS points
+     *
+     * @details Each proof \f$i\f$ is checked by \f$C_i + \sum_j (u_{ij}^{-1} L_{ij} + u_{ij} R_{ij}) + (f_i(\beta_i) -
+     * a_{0,i} b_{0,i}) U_i = a_{0,i} \langle \vec{s}_i, \vec{G} \rangle\f$, see \link IPA::reduce_verify_internal
+     * reduce_verify_internal \endlink. With random \f$\alpha_i\f$ chosen by the verifier, the checks are batched into
+     * \f[ \sum_i \alpha_i \left(C_i + \sum_j (u_{ij}^{-1} L_{ij} + u_{ij} R_{ij}) + (f_i(\beta_i) - a_{0,i} b_{0,i})
+     * U_i\right) = \langle \sum_i \alpha_i a_{0,i} \vec{s}_i, \vec{G} \rangle \f]
+     * so that the \f$2^k\f$-point MSM computing \f$G_0\f$, which dominates the verification of a single proof, is paid
+     * once for the whole batch. The s-vectors are computed in linear time, and the left-hand side is one MSM over the
+     * commitments and the \f$L_{ij}, R_{ij}\f$ of all proofs.
+     *
+     * @param vk Verification key, its SRS must cover the longest proof
+     * @param opening_claims The claims C_i, (β_i, f_i(β_i)), one per proof
+     * @param transcripts Verifier transcripts holding the proofs, in the same order
+     * @return true if all proofs verify, false if at least one does not (except with negligible probability)
+     */
+    static bool batch_verify(const std::shared_ptr<VK>& vk,
+                             std::span<const OpeningClaim<Curve>> opening_claims,
+                             std::span<const std::shared_ptr<NativeTranscript>> transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        ASSERT(opening_claims.size() == transcripts.size());
+        const size_t num_proofs = opening_claims.size();
+        if (num_proofs == 0) {
+            return true;
+        }
+
+        struct ProofData {
+            size_t poly_length;
+            Fr alpha;
+            Fr a_zero;
+            std::vector<Fr> round_challenges_inv;
+        };
+        std::vector<ProofData> proofs(num_proofs);
+
+        // Points and scalars of the left-hand side, starting with the accumulated U terms
+        std::vector<Commitment> lhs_points{ Commitment::one() };
+        std::vector<Fr> lhs_scalars{ Fr::zero() };
+        size_t max_poly_length = 0;
+        for (size_t i = 0; i < num_proofs; i++) {
+            const auto& opening_claim = opening_claims[i];
+            const auto& transcript = transcripts[i];
+            auto& proof = proofs[i];
+
+            // Steps 1 to 4 and 9 of reduce_verify_internal: receive the proof and generate the challenges
+            proof.poly_length = static_cast<uint32_t>(
+                transcript->template receive_from_prover<typename Curve::BaseField>("IPA:poly_degree_plus_1"));
+            // The s-vectors below are built by doubling, so they only cover a power of two
+            if (proof.poly_length == 0 || (proof.poly_length & (proof.poly_length - 1)) != 0) {
+                throw_or_abort("IPA batch verification: the polynomial length " + std::to_string(proof.poly_length) +
+                               " is not a power of two");
+            }
+            const Fr generator_challenge = transcript->template get_challenge<Fr>("IPA:generator_challenge");
+            if (generator_challenge.is_zero()) {
+                throw_or_abort("The generator challenge can't be zero");
+            }
+            const auto log_poly_degree = static_cast<size_t>(numeric::get_msb(proof.poly_length));
+            // The first proof needs no randomisation
+            proof.alpha = i == 0 ? Fr::one() : Fr::random_element();
+            proof.round_challenges_inv.resize(log_poly_degree);
+            for (size_t j = 0; j < log_poly_degree; j++) {
+                std::string index = std::to_string(log_poly_degree - j - 1);
+                auto element_L = transcript->template receive_from_prover<Commitment>("IPA:L_" + index);
+                auto element_R = transcript->template receive_from_prover<Commitment>("IPA:R_" + index);
+                const Fr round_challenge =
+                    transcript->template get_challenge<Fr>("IPA:round_challenge_" + index);
+                if (round_challenge.is_zero()) {
+                    throw_or_abort("Round challenges can't be zero");
+                }
+                proof.round_challenges_inv[j] = round_challenge.invert();
+                lhs_points.push_back(element_L);
+                lhs_points.push_back(element_R);
+                lhs_scalars.push_back(proof.alpha * proof.round_challenges_inv[j]);
+                lhs_scalars.push_back(proof.alpha * round_challenge);
+            }
+            proof.a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+
+            // Step 6: b_zero = ∏_{i ∈ [k]} (1 + u_{i-1}^{-1}. (evaluation)^{2^{i-1}})
+            Fr b_zero = Fr::one();
+            Fr challenge_power = opening_claim.opening_pair.challenge;
+            for (size_t j = 0; j < log_poly_degree; j++) {
+                b_zero *= Fr::one() + proof.round_challenges_inv[log_poly_degree - 1 - j] * challenge_power;
+                challenge_power.self_sqr();
+            }
+
+            // α (C + (f(β) - a₀b₀) U), with U = generator_challenge ⋅ G
+            if (!opening_claim.commitment.is_point_at_infinity()) {
+                lhs_points.push_back(opening_claim.commitment);
+                lhs_scalars.push_back(proof.alpha);
+            }
+            lhs_scalars[0] +=
+                proof.alpha * generator_challenge * (opening_claim.opening_pair.evaluation - proof.a_zero * b_zero);
+            max_poly_length = std::max(max_poly_length, proof.poly_length);
+        }
+
+        std::span<const Commitment> srs_elements = vk->get_monomial_points();
+        if (max_poly_length * 2 > srs_elements.size()) {
+            throw_or_abort("potential bug: Not enough SRS points for IPA!");
+        }
+
+        // Step 7: ∑ α a₀ s, where s[i] = ∏_{j: bit j of i is set} u_{k-1-j}^{-1} is built by doubling, in linear
+        // time. Each thread accumulates the s-vectors of a range of proofs.
+        const size_t num_threads = std::min(get_num_cpus(), num_proofs);
+        std::vector<std::vector<Fr>> thread_s_sums(num_threads);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            auto& s_sum = thread_s_sums[thread_idx];
+            s_sum.resize(max_poly_length, Fr::zero());
+            std::vector<Fr> s_vec(max_poly_length);
+            for (size_t i = thread_idx * num_proofs / num_threads; i < (thread_idx + 1) * num_proofs / num_threads;
+                 i++) {
+                const auto& proof = proofs[i];
+                const size_t log_poly_degree = proof.round_challenges_inv.size();
+                s_vec[0] = proof.alpha * proof.a_zero;
+                for (size_t j = 0; j < log_poly_degree; j++) {
+                    const Fr& challenge_inv = proof.round_challenges_inv[log_poly_degree - 1 - j];
+                    for (size_t k = 0; k < (static_cast<size_t>(1) << j); k++) {
+                        s_vec[k + (static_cast<size_t>(1) << j)] = s_vec[k] * challenge_inv;
+                    }
+                }
+                for (size_t k = 0; k < proof.poly_length; k++) {
+                    s_sum[k] += s_vec[k];
+                }
+            }
+        });
+        std::vector<Fr> s_sum = std::move(thread_s_sums[0]);
+        std::vector<Commitment> G_vec_local(max_poly_length);
+        parallel_for_heuristic(
+            max_poly_length,
+            [&](size_t i) {
+                for (size_t thread_idx = 1; thread_idx < num_threads; thread_idx++) {
+                    s_sum[i] += thread_s_sums[thread_idx][i];
+                }
+                // Even indices of the point table hold the original SRS points
+                G_vec_local[i] = srs_elements[i * 2];
+            },
+            thread_heuristics::FF_ADDITION_COST * num_threads + thread_heuristics::FF_COPY_COST * 2);
+
+        // Step 8: the single MSM over the SRS points
+        GroupElement right_hand_side = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+            { 0, { &s_sum[0], /*size*/ max_poly_length } },
+            { &G_vec_local[0], /*size*/ max_poly_length },
+            vk->pippenger_runtime_state);
+
+        bb::scalar_multiplication::pippenger_runtime_state<Curve> lhs_state(lhs_points.size());
+        GroupElement left_hand_side = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
+            { 0, { &lhs_scalars[0], /*size*/ lhs_scalars.size() } },
+            { &lhs_points[0], /*size*/ lhs_points.size() },
+            lhs_state);
+
+        return left_hand_side.normalize() == right_hand_side.normalize();
+    }
+
     /**
      * @brief A method that produces an IPA opening claim from Shplemini accumulator containing vectors of commitments
      * and scalars and a Shplonk evaluation challenge.
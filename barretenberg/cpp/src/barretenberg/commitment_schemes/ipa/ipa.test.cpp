@@ -224,6 +224,60 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    constexpr size_t num_proofs = 5;
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<std::vector<Fr>> proofs;
+    for (size_t i = 0; i < num_proofs; i++) {
+        // proofs of different lengths share the final MSM
+        const size_t n = (i % 2 == 0) ? 128 : 32;
+        auto poly = Polynomial::random(n);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, this->commit(poly) });
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+        proofs.push_back(prover_transcript->proof_data);
+    }
+
+    auto make_verifier_transcripts = [&]() {
+        std::vector<std::shared_ptr<NativeTranscript>> transcripts;
+        for (const auto& proof : proofs) {
+            transcripts.push_back(std::make_shared<NativeTranscript>(proof));
+        }
+        return transcripts;
+    };
+    EXPECT_TRUE(IPA::batch_verify(this->vk(), opening_claims, make_verifier_transcripts()));
+
+    // A single wrong evaluation makes the batch fail
+    opening_claims[num_proofs - 1].opening_pair.evaluation += Fr::one();
+    EXPECT_FALSE(IPA::batch_verify(this->vk(), opening_claims, make_verifier_transcripts()));
+}
+
+TEST_F(IPATest, BatchVerifyRejectsNonPowerOfTwoLength)
+{
+    using IPA = IPA<Curve>;
+    const size_t n = 128;
+    auto poly = Polynomial::random(n);
+    auto [x, eval] = this->random_eval(poly);
+    const OpeningPair<Curve> opening_pair = { x, eval };
+    std::vector<OpeningClaim<Curve>> opening_claims{ { opening_pair, this->commit(poly) } };
+
+    auto prover_transcript = std::make_shared<NativeTranscript>();
+    IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+
+    // The polynomial length is the first element of the proof; the s-vectors would not cover these
+    for (const uint64_t poly_length : { 0UL, 96UL, 129UL }) {
+        auto proof = prover_transcript->proof_data;
+        proof[0] = Curve::BaseField(poly_length);
+        std::vector<std::shared_ptr<NativeTranscript>> transcripts{ std::make_shared<NativeTranscript>(proof) };
+        EXPECT_ANY_THROW(IPA::batch_verify(this->vk(), opening_claims, transcripts));
+    }
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
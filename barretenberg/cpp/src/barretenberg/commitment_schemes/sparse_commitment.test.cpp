@@ -296,6 +296,122 @@ TYPED_TEST(CommitmentKeyTest, CommitSparseMediumNonZeroStartIndex)
     EXPECT_EQ(sparse_commit_result, commit_result);
 }
 
+/**
+ * @brief Test that commit, which takes the sparse front-end for polynomials made up mostly of zeros, ±1 and small
+ * values, agrees with commit_sparse (plain pippenger over the nonzero inputs)
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, CommitSelectorLike)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const size_t offset = 100;
+
+    Polynomial poly(num_points - offset, num_points, offset);
+    for (size_t i = offset; i < num_points; ++i) {
+        switch (i % 8) {
+        case 0:
+            poly.at(i) = Fr::one();
+            break;
+        case 1:
+            poly.at(i) = -Fr::one();
+            break;
+        case 2:
+            poly.at(i) = Fr(i);
+            break;
+        case 3:
+            poly.at(i) = -Fr(i);
+            break;
+        case 4:
+            poly.at(i) = Fr::random_element();
+            break;
+        default:
+            break;
+        }
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    G1 commit_result = key->commit(poly);
+    G1 sparse_commit_result = key->commit_sparse(poly);
+
+    EXPECT_EQ(commit_result, sparse_commit_result);
+}
+
+/**
+ * @brief Test that the fixed-base commitment strategy agrees with pippenger, including for polynomials with a nonzero
+ * start index and for polynomials exceeding the precomputed points (which fall back to pippenger)
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, CommitFixedBase)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const size_t num_precomputed = 1 << 11;
+    const size_t start_index = 397; // random start index
+    const size_t num_nonzero = 1000;
+
+    Polynomial poly(num_nonzero, num_points, start_index);
+    for (size_t i = start_index; i < start_index + num_nonzero; ++i) {
+        poly.at(i) = Fr::random_element();
+    }
+    Polynomial large_poly = Polynomial::random(num_points);
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    G1 expected_result = key->commit(poly);
+    G1 large_expected_result = key->commit(large_poly);
+
+    key->precompute_fixed_base_tables(num_precomputed);
+    EXPECT_EQ(key->commit_fixed_base(poly), expected_result);
+    EXPECT_EQ(key->commit(poly), expected_result);
+    EXPECT_EQ(key->commit(large_poly), large_expected_result);
+}
+
+/**
+ * @brief Test that batch_commit agrees with committing to each polynomial individually, for polynomials of different
+ * sizes, start indices and sparsity
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+
+    Polynomial full_poly = Polynomial::random(num_points);
+    Polynomial offset_poly(1000, num_points, 397);
+    for (size_t i = 397; i < 1397; ++i) {
+        offset_poly.at(i) = Fr::random_element();
+    }
+    Polynomial sparse_poly(num_points);
+    for (size_t i = 0; i < num_points; i += 17) {
+        sparse_poly.at(i) = Fr::random_element();
+    }
+    Polynomial zero_poly(num_points);
+    Polynomial small_poly = Polynomial::random(7);
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    RefArray polynomials{ full_poly, offset_poly, sparse_poly, zero_poly, small_poly };
+    auto commitments = key->batch_commit(polynomials);
+
+    ASSERT_EQ(commitments.size(), polynomials.size());
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        EXPECT_EQ(commitments[i], key->commit(polynomials[i]));
+    }
+}
+
 /**
  * @brief Test commit_structured on polynomial with blocks of non-zero values (like wires when using structured trace)
  *
@@ -11,11 +11,14 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <array>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
 
 namespace bb {
@@ -55,6 +58,43 @@ template <> class VerifierCommitmentKey<curve::BN254> {
         return (result == Curve::TargetField::one());
     }
 
+    /**
+     * @brief verifies many pairing equations over 2 points at the cost of one
+     * @details The equations are combined with random 128-bit scalars rᵢ, r₀ = 1, into the single equation
+     * e(∑ rᵢ⋅P₀ᵢ,[1]₂)e(∑ rᵢ⋅P₁ᵢ,[x]₂) ≡ [1]ₜ, which holds with probability at most 2⁻¹²⁸ unless all of them do. The
+     * two sums are computed as multi-scalar multiplications that share one double-and-add pass over the scalar bits,
+     * so the number of doublings does not grow with the number of equations.
+     *
+     * @param pairing_points the pairs (P₀ᵢ, P₁ᵢ)
+     * @return e(P₀ᵢ,[1]₂)e(P₁ᵢ,[x]₂) ≡ [1]ₜ for all i
+     */
+    bool batch_pairing_check(std::span<const std::array<GroupElement, 2>> pairing_points)
+    {
+        static constexpr size_t BATCHING_SCALAR_BITS = 128;
+        if (pairing_points.empty()) {
+            return true;
+        }
+        auto& engine = numeric::get_randomness();
+        std::vector<uint256_t> batching_scalars(pairing_points.size());
+        batching_scalars[0] = 1;
+        for (size_t i = 1; i < pairing_points.size(); i++) {
+            batching_scalars[i] = uint256_t(engine.get_random_uint64(), engine.get_random_uint64(), 0, 0);
+        }
+        GroupElement p0 = GroupElement::infinity();
+        GroupElement p1 = GroupElement::infinity();
+        for (size_t bit = BATCHING_SCALAR_BITS; bit-- > 0;) {
+            p0.self_dbl();
+            p1.self_dbl();
+            for (size_t i = 0; i < pairing_points.size(); i++) {
+                if (batching_scalars[i].get_bit(bit)) {
+                    p0 += pairing_points[i][0];
+                    p1 += pairing_points[i][1];
+                }
+            }
+        }
+        return pairing_check(p0, p1);
+    }
+
   private:
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> srs;
 };
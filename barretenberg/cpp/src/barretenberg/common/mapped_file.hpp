@@ -0,0 +1,154 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+namespace bb {
+
+/**
+ * @brief Read-only view of the contents of a file.
+ * @details Natively the file is memory mapped (MAP_SHARED, PROT_READ): pages are only faulted in when touched and are
+ * backed by the page cache, so nothing is copied onto the heap and concurrent processes mapping the same file share the
+ * physical memory. On wasm, which has no mmap, the file is read into an owned buffer instead.
+ *
+ * With copy_on_write the file is mapped MAP_PRIVATE and writable instead, for callers that hand the contents to code
+ * expecting mutable memory: pages are still shared through the page cache until written, a written page becomes a
+ * private copy and the file itself is never modified.
+ *
+ * Check validity with operator bool; a missing or unreadable file yields an empty, invalid view.
+ */
+class MappedFile {
+  public:
+    MappedFile() = default;
+
+    explicit MappedFile(const std::string& path, bool copy_on_write = false)
+    {
+#ifndef __wasm__
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return;
+        }
+        struct stat st {};
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            return;
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            const int prot = copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ;
+            void* mapping = mmap(nullptr, size_, prot, copy_on_write ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) {
+                size_ = 0;
+                close(fd);
+                return;
+            }
+            data_ = static_cast<uint8_t*>(mapping);
+        }
+        // The mapping holds its own reference to the file.
+        close(fd);
+        valid_ = true;
+        writable_ = copy_on_write;
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return;
+        }
+        buffer_.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+        if (!file) {
+            buffer_.clear();
+            return;
+        }
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+        valid_ = true;
+        // The buffer is owned, so writing to it never reaches the file
+        writable_ = copy_on_write;
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            valid_ = std::exchange(other.valid_, false);
+            writable_ = std::exchange(other.writable_, false);
+            buffer_ = std::move(other.buffer_);
+        }
+        return *this;
+    }
+
+    ~MappedFile() { release(); }
+
+    explicit operator bool() const { return valid_; }
+
+    std::span<const uint8_t> data() const { return { data_, size_ }; }
+
+    /**
+     * @brief Writable view of the contents, empty unless the file was opened copy_on_write.
+     */
+    std::span<uint8_t> mutable_data() { return writable_ ? std::span<uint8_t>{ data_, size_ } : std::span<uint8_t>{}; }
+
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Hint that the given byte range (default: the whole file) will be read soon, so the kernel can start
+     * reading it in before it is touched.
+     */
+    void will_need([[maybe_unused]] size_t offset = 0, [[maybe_unused]] size_t length = 0) const
+    {
+#ifndef __wasm__
+        if (data_ == nullptr || offset >= size_) {
+            return;
+        }
+        // madvise wants a page aligned start address.
+        const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t aligned_offset = offset - (offset % page_size);
+        const size_t end = (length == 0 || offset + length > size_) ? size_ : offset + length;
+        madvise(data_ + aligned_offset, end - aligned_offset, MADV_WILLNEED);
+#endif
+    }
+
+  private:
+    void release()
+    {
+#ifndef __wasm__
+        if (data_ != nullptr) {
+            munmap(data_, size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        valid_ = false;
+        writable_ = false;
+        buffer_.clear();
+    }
+
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    bool valid_ = false;
+    bool writable_ = false;
+    // Only used where the file cannot be mapped.
+    std::vector<uint8_t> buffer_;
+};
+
+} // namespace bb
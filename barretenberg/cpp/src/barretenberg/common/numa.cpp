@@ -0,0 +1,166 @@
+#include "numa.hpp"
+#include "barretenberg/common/log.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdlib>
+#include <string>
+
+#ifdef __linux__
+#include <filesystem>
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace bb::numa {
+
+namespace {
+
+std::atomic<bool> pinning_enabled = [] {
+    const char* env = std::getenv("BB_NUMA_PIN");
+    return env != nullptr && std::string(env) == "1";
+}();
+
+#ifdef __linux__
+std::vector<size_t> get_allowed_cpus()
+{
+    std::vector<size_t> cpus;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+        return cpus;
+    }
+    for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &mask)) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+Topology read_topology()
+{
+    const std::vector<size_t> allowed_cpus = get_allowed_cpus();
+    auto is_allowed = [&](size_t cpu) { return std::binary_search(allowed_cpus.begin(), allowed_cpus.end(), cpu); };
+
+    // Nodes are numbered but not necessarily contiguously, collect them in order
+    std::vector<std::pair<size_t, std::vector<size_t>>> nodes;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator("/sys/devices/system/node", error)) {
+        const std::string name = entry.path().filename().string();
+        size_t node = 0;
+        if (name.rfind("node", 0) != 0 ||
+            std::from_chars(name.data() + 4, name.data() + name.size(), node).ptr != name.data() + name.size()) {
+            continue;
+        }
+        std::ifstream file(entry.path() / "cpulist");
+        std::string cpu_list;
+        std::getline(file, cpu_list);
+        std::vector<size_t> cpus = parse_cpu_list(cpu_list);
+        std::erase_if(cpus, [&](size_t cpu) { return !is_allowed(cpu); });
+        if (!cpus.empty()) {
+            nodes.emplace_back(node, std::move(cpus));
+        }
+    }
+    std::sort(nodes.begin(), nodes.end());
+
+    Topology topology;
+    for (auto& [node, cpus] : nodes) {
+        topology.node_cpus.push_back(std::move(cpus));
+    }
+    if (topology.node_cpus.empty() && !allowed_cpus.empty()) {
+        topology.node_cpus.push_back(allowed_cpus);
+    }
+    return topology;
+}
+#endif
+
+} // namespace
+
+std::vector<size_t> parse_cpu_list(std::string_view cpu_list)
+{
+    std::vector<size_t> cpus;
+    while (!cpu_list.empty() && (cpu_list.back() == '\n' || cpu_list.back() == ' ')) {
+        cpu_list.remove_suffix(1);
+    }
+    const char* ptr = cpu_list.data();
+    const char* end = cpu_list.data() + cpu_list.size();
+    while (ptr < end) {
+        size_t first = 0;
+        auto result = std::from_chars(ptr, end, first);
+        if (result.ec != std::errc()) {
+            return {};
+        }
+        size_t last = first;
+        ptr = result.ptr;
+        if (ptr < end && *ptr == '-') {
+            result = std::from_chars(ptr + 1, end, last);
+            if (result.ec != std::errc() || last < first) {
+                return {};
+            }
+            ptr = result.ptr;
+        }
+        for (size_t cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+        if (ptr < end) {
+            if (*ptr != ',') {
+                return {};
+            }
+            ++ptr;
+        }
+    }
+    return cpus;
+}
+
+const Topology& get_topology()
+{
+#ifdef __linux__
+    static const Topology topology = read_topology();
+#else
+    static const Topology topology;
+#endif
+    return topology;
+}
+
+void set_thread_pinning(bool enabled)
+{
+    pinning_enabled = enabled;
+}
+
+bool thread_pinning_enabled()
+{
+    return pinning_enabled;
+}
+
+void pin_worker_thread([[maybe_unused]] size_t thread_index)
+{
+#ifdef __linux__
+    const Topology& topology = get_topology();
+    if (!pinning_enabled || thread_index == 0 || topology.num_nodes() < 2) {
+        return;
+    }
+    size_t num_cpus = 0;
+    for (const auto& cpus : topology.node_cpus) {
+        num_cpus += cpus.size();
+    }
+    // Walk the nodes to the one holding the (thread_index mod num_cpus)-th cpu
+    size_t position = thread_index % num_cpus;
+    size_t node = 0;
+    while (position >= topology.node_cpus[node].size()) {
+        position -= topology.node_cpus[node].size();
+        ++node;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (size_t cpu : topology.node_cpus[node]) {
+        CPU_SET(cpu, &mask);
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) != 0) {
+        info("warning: could not pin thread ", thread_index, " to NUMA node ", node);
+    }
+#endif
+}
+
+} // namespace bb::numa
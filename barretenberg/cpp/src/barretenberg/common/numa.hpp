@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief NUMA topology and thread placement
+ *
+ * @details On multi-socket machines memory is local to one NUMA node, and a page is placed on the node of the thread
+ * that first touches it. A polynomial zeroed by a single thread thus lives on a single node, and every later parallel
+ * pass over it is bound by that node's memory bandwidth and by the cross-socket link. Two things keep memory spread
+ * over the nodes along with the work:
+ * - large polynomials are initialised in parallel (see Polynomial), so their pages are first touched by the pool;
+ * - with pinning enabled, the parallel_for workers are bound to the cpus of a node, filling one node after the other,
+ *   so the kernel does not migrate them away from the pages they touched.
+ *
+ * The topology is read from /sys/devices/system/node (no libnuma dependency). Only the cpus of the process affinity
+ * mask are considered. Without sysfs, or outside Linux, the machine is a single node and pinning is a no-op.
+ */
+namespace bb::numa {
+
+struct Topology {
+    // The cpus of each node, ascending; nodes without (allowed) cpus are left out
+    std::vector<std::vector<size_t>> node_cpus;
+
+    size_t num_nodes() const { return node_cpus.size(); }
+};
+
+/**
+ * @brief Parse a sysfs cpu list such as "0-3,8,10-11"; returns an empty list on malformed input
+ */
+std::vector<size_t> parse_cpu_list(std::string_view cpu_list);
+
+/**
+ * @brief The topology of the machine, read once
+ */
+const Topology& get_topology();
+
+/**
+ * @brief Enable or disable pinning of the thread pool workers. Initially enabled if the BB_NUMA_PIN environment
+ * variable is "1". Only affects workers started after the call, so it should be set before the first parallel_for.
+ */
+void set_thread_pinning(bool enabled);
+bool thread_pinning_enabled();
+
+/**
+ * @brief Bind the calling pool thread to the cpus of the NUMA node it is assigned to
+ *
+ * @param thread_index Index of the thread in the pool, 0 being the thread calling parallel_for (which is not pinned).
+ * Threads are assigned to nodes in blocks, in the order of the cpus of the topology.
+ */
+void pin_worker_thread(size_t thread_index);
+
+} // namespace bb::numa
@@ -0,0 +1,32 @@
+#include "numa.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+
+namespace bb {
+
+TEST(Numa, ParseCpuList)
+{
+    EXPECT_EQ(numa::parse_cpu_list("0-3,8,10-11\n"), (std::vector<size_t>{ 0, 1, 2, 3, 8, 10, 11 }));
+    EXPECT_EQ(numa::parse_cpu_list("5"), (std::vector<size_t>{ 5 }));
+    EXPECT_TRUE(numa::parse_cpu_list("").empty());
+    EXPECT_TRUE(numa::parse_cpu_list("3-1").empty());
+    EXPECT_TRUE(numa::parse_cpu_list("0-x").empty());
+}
+
+TEST(Numa, Topology)
+{
+    // Every machine has at least one node, and a cpu belongs to a single node
+    const auto& topology = numa::get_topology();
+    std::vector<size_t> cpus;
+    for (const auto& node_cpus : topology.node_cpus) {
+        EXPECT_FALSE(node_cpus.empty());
+        cpus.insert(cpus.end(), node_cpus.begin(), node_cpus.end());
+    }
+    std::sort(cpus.begin(), cpus.end());
+    EXPECT_EQ(std::adjacent_find(cpus.begin(), cpus.end()), cpus.end());
+#ifdef __linux__
+    EXPECT_GE(topology.num_nodes(), 1);
+#endif
+}
+
+} // namespace bb
@@ -0,0 +1,296 @@
+#include "numa.hpp"
+#include "task_group.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+#ifndef NO_MULTITHREADING
+namespace {
+
+struct Task {
+    std::function<void()> func;
+    bb::TaskGroup* group;
+};
+
+/**
+ * A deque of tasks. The owning thread pushes and pops at the back, thieves steal from the front. Guarded by a mutex
+ * rather than lock-free (Chase-Lev): tasks are coarse (loop chunks) and the deques are rarely contended.
+ */
+class TaskDeque {
+  public:
+    void push(Task task)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+
+    std::optional<Task> pop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (tasks.empty()) {
+            return std::nullopt;
+        }
+        Task task = std::move(tasks.back());
+        tasks.pop_back();
+        return task;
+    }
+
+    std::optional<Task> steal()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (tasks.empty()) {
+            return std::nullopt;
+        }
+        Task task = std::move(tasks.front());
+        tasks.pop_front();
+        return task;
+    }
+
+  private:
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+// Index of the current thread's deque within the scheduler; threads outside the pool use the shared queue
+constexpr size_t SHARED_QUEUE = static_cast<size_t>(-1);
+thread_local size_t current_deque = SHARED_QUEUE;
+
+class WorkStealingScheduler {
+  public:
+    WorkStealingScheduler(size_t num_workers);
+    WorkStealingScheduler(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler(WorkStealingScheduler&& other) = delete;
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler& operator=(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler& operator=(WorkStealingScheduler&& other) = delete;
+
+    static WorkStealingScheduler& get()
+    {
+        static WorkStealingScheduler scheduler(bb::get_num_cpus() - 1);
+        return scheduler;
+    }
+
+    size_t num_threads() const { return workers.size() + 1; }
+
+    void push(Task task)
+    {
+        if (current_deque == SHARED_QUEUE) {
+            shared_queue.push(std::move(task));
+        } else {
+            deques[current_deque]->push(std::move(task));
+        }
+        num_queued.fetch_add(1);
+        // A worker going to sleep registers itself before re-checking num_queued, so it either sees this task or is
+        // woken up here
+        if (num_sleeping.load() > 0) {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            sleep_condition.notify_one();
+        }
+    }
+
+    /**
+     * Run one queued task: the most recent one of the current thread, else the oldest one of the shared queue or of
+     * another thread. Returns false if there was nothing to run.
+     */
+    bool run_one()
+    {
+        std::optional<Task> task;
+        if (current_deque != SHARED_QUEUE) {
+            task = deques[current_deque]->pop();
+        }
+        if (!task) {
+            task = shared_queue.steal();
+        }
+        for (size_t i = 1; !task && i <= deques.size(); ++i) {
+            // Start stealing from the next deque along, so that thieves spread over the victims
+            const size_t victim = current_deque == SHARED_QUEUE ? i - 1 : (current_deque + i) % deques.size();
+            task = deques[victim]->steal();
+        }
+        if (!task) {
+            return false;
+        }
+        num_queued.fetch_sub(1);
+        std::exception_ptr exception;
+        try {
+            task->func();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        task->group->complete_task(exception);
+        return true;
+    }
+
+  private:
+    BB_NO_PROFILE void worker_loop(size_t worker_index);
+
+    std::vector<std::unique_ptr<TaskDeque>> deques;
+    TaskDeque shared_queue;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> num_queued = 0;
+    std::atomic<size_t> num_sleeping = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    bool stop = false;
+};
+
+WorkStealingScheduler::WorkStealingScheduler(size_t num_workers)
+{
+    deques.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        deques.push_back(std::make_unique<TaskDeque>());
+    }
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&WorkStealingScheduler::worker_loop, this, i);
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    sleep_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingScheduler::worker_loop(size_t worker_index)
+{
+    // Spin (yielding) for a while before sleeping, as parallel_for calls tend to come in quick succession
+    constexpr size_t SPINS_BEFORE_SLEEP = 1 << 10;
+    current_deque = worker_index;
+    // The calling thread of parallel_for is thread 0 of the pool
+    bb::numa::pin_worker_thread(worker_index + 1);
+    size_t idle_spins = 0;
+    while (true) {
+        if (run_one()) {
+            idle_spins = 0;
+            continue;
+        }
+        if (++idle_spins < SPINS_BEFORE_SLEEP) {
+            std::this_thread::yield();
+            continue;
+        }
+        idle_spins = 0;
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_sleeping.fetch_add(1);
+        sleep_condition.wait(lock, [this] { return num_queued.load() > 0 || stop; });
+        num_sleeping.fetch_sub(1);
+        if (stop) {
+            break;
+        }
+    }
+}
+
+} // namespace
+#endif
+
+namespace bb {
+
+TaskGroup::~TaskGroup()
+{
+    wait_for_tasks();
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+#ifdef NO_MULTITHREADING
+    std::exception_ptr task_exception;
+    try {
+        task();
+    } catch (...) {
+        task_exception = std::current_exception();
+    }
+    pending_tasks.fetch_add(1);
+    complete_task(task_exception);
+#else
+    pending_tasks.fetch_add(1);
+    WorkStealingScheduler::get().push({ std::move(task), this });
+#endif
+}
+
+void TaskGroup::wait()
+{
+    wait_for_tasks();
+    std::unique_lock<std::mutex> lock(exception_mutex);
+    if (exception) {
+        std::rethrow_exception(std::exchange(exception, nullptr));
+    }
+}
+
+void TaskGroup::complete_task(std::exception_ptr task_exception)
+{
+    if (task_exception) {
+        std::unique_lock<std::mutex> lock(exception_mutex);
+        if (!exception) {
+            exception = task_exception;
+        }
+    }
+    pending_tasks.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void TaskGroup::wait_for_tasks()
+{
+#ifndef NO_MULTITHREADING
+    auto& scheduler = WorkStealingScheduler::get();
+    while (pending_tasks.load(std::memory_order_acquire) > 0) {
+        // Help out rather than block; this is what makes nested parallelism safe
+        if (!scheduler.run_one()) {
+            std::this_thread::yield();
+        }
+    }
+#endif
+}
+
+#ifndef NO_MULTITHREADING
+/**
+ * A work-stealing strategy built on TaskGroup. The iteration range is split recursively: each task hands the upper half
+ * of its range to the pool and carries on with the lower half, down to a grain of a few chunks per thread, so idle
+ * threads steal large ranges and the splitting itself is parallel. Unlike the other strategies, parallel_for may be
+ * called from within a parallel_for iteration: the waiting thread runs queued iterations instead of blocking.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    // Number of chunks per thread the range is split into, for load balancing
+    constexpr size_t CHUNKS_PER_THREAD = 4;
+    const size_t num_threads = WorkStealingScheduler::get().num_threads();
+    if (num_iterations <= 1 || num_threads == 1) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+    const size_t grain = std::max<size_t>(1, num_iterations / (num_threads * CHUNKS_PER_THREAD));
+
+    TaskGroup group;
+    std::function<void(size_t, size_t)> run_range = [&](size_t start, size_t end) {
+        while (end - start > grain) {
+            const size_t mid = start + (end - start) / 2;
+            group.run([&run_range, mid, end]() { run_range(mid, end); });
+            end = mid;
+        }
+        for (size_t i = start; i < end; ++i) {
+            func(i);
+        }
+    };
+    run_range(0, num_iterations);
+    group.wait();
+}
+#endif
+
+} // namespace bb
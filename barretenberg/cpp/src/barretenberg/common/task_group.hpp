@@ -0,0 +1,46 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+namespace bb {
+
+/**
+ * @brief A set of tasks run on the work-stealing thread pool and waited for together
+ *
+ * @details Each pool thread owns a deque of tasks: it pushes and pops its own tasks at the back, and idle threads steal
+ * from the front (the oldest, and for recursively split work the largest, tasks). Tasks submitted from threads outside
+ * the pool go to a shared queue. Rather than blocking, wait() runs queued tasks (of any group) until the tasks of this
+ * group are done, so a task may itself use a TaskGroup or parallel_for: nested parallelism neither deadlocks nor
+ * oversubscribes the cores.
+ *
+ * If a task throws, the first exception is rethrown by wait() once all tasks of the group have finished.
+ *
+ * With NO_MULTITHREADING, run() executes the task immediately.
+ */
+class TaskGroup {
+  public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup(TaskGroup&& other) = delete;
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+    TaskGroup& operator=(TaskGroup&& other) = delete;
+    ~TaskGroup();
+
+    void run(std::function<void()> task);
+    void wait();
+
+    // Called by the scheduler once a task of this group has run
+    void complete_task(std::exception_ptr exception);
+
+  private:
+    void wait_for_tasks();
+
+    std::atomic<size_t> pending_tasks = 0;
+    std::mutex exception_mutex;
+    std::exception_ptr exception;
+};
+
+} // namespace bb
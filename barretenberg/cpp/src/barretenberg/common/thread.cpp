@@ -34,6 +34,12 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: None of the pools above allow a parallel_for within a parallel_for (mutex_pool throws), which forced callers
+ * with uneven, independent pieces of work (e.g. the AVM lookup inverses) to choose between parallelising across the
+ * pieces or within them. "work_stealing" builds parallel_for on per-thread task deques and a TaskGroup whose wait()
+ * runs queued tasks instead of blocking, so nesting composes. It is the default on native builds; WASM stays on
+ * mutex_pool until it has been tested against the wasi-sdk pthreads.
  */
 
 namespace bb {
@@ -69,6 +75,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,8 +90,12 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+#ifdef __wasm__
+    parallel_for_mutex_pool(num_iterations, func);
+#else
+    parallel_for_work_stealing(num_iterations, func);
+#endif
 #endif
 #endif
 }
@@ -0,0 +1,87 @@
+#include "thread.hpp"
+#include "task_group.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace bb {
+
+TEST(Thread, ParallelForRunsEachIterationOnce)
+{
+    for (size_t num_iterations : { 0UL, 1UL, 7UL, 1000UL }) {
+        std::vector<std::atomic<size_t>> counts(num_iterations);
+        parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+        for (const auto& count : counts) {
+            EXPECT_EQ(count, 1);
+        }
+    }
+}
+
+TEST(Thread, ParallelForRange)
+{
+    const size_t num_points = 1013;
+    std::vector<std::atomic<size_t>> counts(num_points);
+    parallel_for_range(
+        num_points,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                counts[i]++;
+            }
+        },
+        0);
+    for (const auto& count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+#if !defined(__wasm__) && defined(NO_OMP_MULTITHREADING)
+TEST(Thread, NestedParallelFor)
+{
+    const size_t num_outer = 17;
+    const size_t num_inner = 123;
+    std::vector<std::atomic<size_t>> counts(num_outer * num_inner);
+    parallel_for(num_outer, [&](size_t outer) {
+        parallel_for(num_inner, [&](size_t inner) { counts[outer * num_inner + inner]++; });
+    });
+    for (const auto& count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
+#endif
+
+TEST(Thread, TaskGroup)
+{
+    std::atomic<size_t> sum = 0;
+    TaskGroup group;
+    for (size_t i = 1; i <= 100; ++i) {
+        group.run([&sum, i]() {
+            TaskGroup nested;
+            nested.run([&sum, i]() { sum += i; });
+            nested.run([&sum, i]() { sum += i; });
+            nested.wait();
+        });
+    }
+    group.wait();
+    EXPECT_EQ(sum, 100 * 101);
+}
+
+TEST(Thread, TaskGroupRethrows)
+{
+    std::atomic<size_t> num_run = 0;
+    TaskGroup group;
+    for (size_t i = 0; i < 10; ++i) {
+        group.run([&num_run, i]() {
+            num_run++;
+            if (i == 3) {
+                throw std::runtime_error("task failed");
+            }
+        });
+    }
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    EXPECT_EQ(num_run, 10);
+    // The exception is only reported once
+    EXPECT_NO_THROW(group.wait());
+}
+
+} // namespace bb
@@ -7,16 +7,21 @@
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -45,6 +50,7 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     using FindLeafCallback = std::function<void(const TypedResponse<FindLeafIndexResponse>&)>;
     using GetLeafCallback = std::function<void(const TypedResponse<GetLeafResponse>&)>;
     using CommitCallback = std::function<void(const Response&)>;
+    using CheckpointBlockCallback = std::function<void(const Response&)>;
     using RollbackCallback = std::function<void(const Response&)>;
     using RemoveHistoricBlockCallback = std::function<void(const Response&)>;
     using UnwindBlockCallback = std::function<void(const Response&)>;
@@ -188,6 +194,11 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
      */
     void commit(const CommitCallback& on_completion);
 
+    /**
+     * @brief Record the uncommitted state as a block, to be written to the backing store by the next commit
+     */
+    void checkpoint_block(const CheckpointBlockCallback& on_completion);
+
     /**
      * @brief Rollback the uncommitted changes
      */
@@ -236,6 +247,13 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    void hash_subtree(std::span<fr> nodes, uint32_t& level, index_t& index);
+
+    void hash_subtrees_in_parallel(std::span<fr> nodes, uint32_t level, index_t index, uint32_t num_subtrees);
+
+    // Batches are split into subtrees for the workers only if each subtree gets at least this many leaves
+    static constexpr uint32_t MIN_PARALLEL_SUBTREE_SIZE = 64;
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -724,6 +742,14 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit(const CommitCa
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::checkpoint_block(
+    const CheckpointBlockCallback& on_completion)
+{
+    auto job = [=, this]() { execute_and_report([=, this]() { store_->checkpoint_block(); }, on_completion); };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::rollback(const RollbackCallback& on_completion)
 {
@@ -864,23 +890,23 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         }
     }
 
-    // Hash the values as a sub tree and insert them
-    while (number_to_insert > 1) {
-        number_to_insert >>= 1;
-        index >>= 1;
-        --level;
-        // std::cout << "To INSERT " << number_to_insert << std::endl;
-        for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
+    // Hash the values as a sub tree and insert them. Large batches are first split into aligned subtrees, each hashed
+    // down to its root by a single worker, so only the levels above the subtree roots are left to hash here.
+    uint32_t num_subtrees = static_cast<uint32_t>(
+        std::min<uint64_t>(workers_->num_threads(), number_to_insert / MIN_PARALLEL_SUBTREE_SIZE));
+    if (num_subtrees > 1) {
+        num_subtrees = 1U << numeric::get_msb(num_subtrees);
+        const uint32_t subtree_size = number_to_insert / num_subtrees;
+        hash_subtrees_in_parallel(hashes_local, level, index, num_subtrees);
+        for (uint32_t i = 0; i < num_subtrees; ++i) {
+            hashes_local[i] = hashes_local[i * subtree_size];
         }
+        const uint32_t subtree_depth = numeric::get_msb(subtree_size);
+        level -= subtree_depth;
+        index >>= subtree_depth;
+        number_to_insert = num_subtrees;
     }
+    hash_subtree(std::span<fr>{ hashes_local.data(), number_to_insert }, level, index);
 
     fr new_hash = hashes_local[0];
 
@@ -925,4 +951,87 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     store_->put_meta(meta);
 }
 
+/**
+ * @brief Hashes the nodes of an aligned subtree level by level up to its root, writing every parent to the store
+ * @param nodes The 2^k nodes at the bottom of the subtree, overwritten with the parents; the root ends up in nodes[0]
+ * @param level The level of the nodes, updated to the level of the root
+ * @param index The index of the first node within its level, updated to the index of the root
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_subtree(std::span<fr> nodes,
+                                                                        uint32_t& level,
+                                                                        index_t& index)
+{
+    size_t number_to_insert = nodes.size();
+    std::vector<fr> parent_hashes(number_to_insert >> 1);
+    while (number_to_insert > 1) {
+        number_to_insert >>= 1;
+        index >>= 1;
+        --level;
+        // std::cout << "To INSERT " << number_to_insert << std::endl;
+        std::span<fr> parents{ parent_hashes.data(), number_to_insert };
+        HashingPolicy::hash_pairs(nodes.first(number_to_insert * 2), parents);
+        for (size_t i = 0; i < number_to_insert; ++i) {
+            fr left = nodes[i * 2];
+            fr right = nodes[i * 2 + 1];
+            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << parents[i] << std::endl;
+            store_->put_node_by_hash(parents[i], { .left = left, .right = right, .ref = 1 });
+            store_->put_cached_node_by_index(level, index + i, parents[i]);
+            // std::cout << "Writing node hash " << parents[i] << " level " << level << " index " << index + i
+            //           << std::endl;
+        }
+        std::copy(parents.begin(), parents.end(), nodes.begin());
+    }
+}
+
+/**
+ * @brief Hashes num_subtrees equal aligned subtrees of the nodes, leaving the root of subtree i at the front of its
+ * nodes
+ * @details The subtrees are claimed one at a time by the calling thread and by jobs enqueued on the workers. The
+ * calling thread keeps claiming until none are left and then only waits for the subtrees being hashed by other
+ * workers, so it never waits on a job still queued behind it. Jobs starting after every subtree is claimed do nothing.
+ */
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_subtrees_in_parallel(std::span<fr> nodes,
+                                                                                     uint32_t level,
+                                                                                     index_t index,
+                                                                                     uint32_t num_subtrees)
+{
+    struct SubtreeJobs {
+        std::atomic_uint32_t next{ 0 };
+        Signal remaining;
+        std::mutex mutex;
+        std::optional<std::string> failure;
+
+        SubtreeJobs(uint32_t num_subtrees)
+            : remaining(num_subtrees)
+        {}
+    };
+    const size_t subtree_size = nodes.size() / num_subtrees;
+    std::shared_ptr<SubtreeJobs> jobs = std::make_shared<SubtreeJobs>(num_subtrees);
+
+    auto hash_claimed_subtrees = [=, this]() {
+        for (uint32_t i = jobs->next.fetch_add(1); i < num_subtrees; i = jobs->next.fetch_add(1)) {
+            try {
+                uint32_t subtree_level = level;
+                index_t subtree_index = index + i * subtree_size;
+                hash_subtree(nodes.subspan(i * subtree_size, subtree_size), subtree_level, subtree_index);
+            } catch (std::exception& e) {
+                std::unique_lock lock(jobs->mutex);
+                jobs->failure = e.what();
+            }
+            jobs->remaining.signal_decrement();
+        }
+    };
+    for (uint32_t i = 1; i < num_subtrees; ++i) {
+        workers_->enqueue(hash_claimed_subtrees);
+    }
+    hash_claimed_subtrees();
+    jobs->remaining.wait_for_level(0);
+
+    if (jobs->failure.has_value()) {
+        throw std::runtime_error(jobs->failure.value());
+    }
+}
+
 } // namespace bb::crypto::merkle_tree
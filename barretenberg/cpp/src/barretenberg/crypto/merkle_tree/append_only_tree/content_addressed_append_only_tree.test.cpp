@@ -796,6 +796,41 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_multiple_values_in_a
     check_sibling_path(tree, 4 - 1, memdb.get_sibling_path(4 - 1));
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_large_batches_across_workers)
+{
+    constexpr size_t depth = 12;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(8);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Each of these batches is large enough to be hashed as several subtrees by the workers
+    std::vector<size_t> batchSize = { 512, 256, 129 };
+    index_t expected_size = 0;
+
+    for (size_t size : batchSize) {
+        std::vector<fr> to_add;
+
+        for (size_t j = 0; j < size; ++j) {
+            size_t ind = expected_size + j;
+            memdb.update_element(ind, VALUES[ind]);
+            to_add.push_back(VALUES[ind]);
+        }
+        expected_size += size;
+        add_values(tree, to_add);
+        check_size(tree, expected_size);
+        check_root(tree, memdb.root());
+        for (index_t i = 0; i < expected_size; i += 37) {
+            check_sibling_path(tree, i, memdb.get_sibling_path(i));
+        }
+        check_sibling_path(tree, expected_size - 1, memdb.get_sibling_path(expected_size - 1));
+    }
+    commit_tree(tree);
+    check_root(tree, memdb.root(), false);
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_commit_multiple_blocks)
 {
     constexpr size_t depth = 10;
@@ -833,6 +868,63 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_commit_multiple_blocks)
     }
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_commit_checkpointed_blocks_together)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    ThreadPoolPtr pool = make_thread_pool(1);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    auto checkpoint_tree = [&]() {
+        Signal signal;
+        tree.checkpoint_block([&](const Response& response) {
+            EXPECT_EQ(response.success, true);
+            signal.signal_level();
+        });
+        signal.wait_for_level();
+    };
+
+    std::vector<size_t> batchSize = { 8, 20, 0, 32 };
+    std::vector<fr> roots;
+    std::vector<fr_sibling_path> first_paths;
+    index_t expected_size = 0;
+
+    for (size_t size : batchSize) {
+        std::vector<fr> to_add;
+        for (size_t j = 0; j < size; ++j) {
+            size_t ind = expected_size + j;
+            memdb.update_element(ind, VALUES[ind]);
+            to_add.push_back(VALUES[ind]);
+        }
+        expected_size += size;
+        add_values(tree, to_add);
+        checkpoint_tree();
+        // a block without any leaves is not recorded
+        if (size != 0) {
+            roots.push_back(memdb.root());
+            first_paths.push_back(memdb.get_sibling_path(0));
+        }
+    }
+    check_block_height(tree, 0);
+    commit_tree(tree);
+
+    check_size(tree, expected_size, false);
+    check_root(tree, memdb.root(), false);
+    check_block_height(tree, roots.size());
+    for (size_t i = 0; i < roots.size(); ++i) {
+        check_block_and_root_data(db, i + 1, roots[i], true);
+        check_historic_sibling_path(tree, 0, first_paths[i], i + 1);
+    }
+
+    // the last block can be unwound just as if it had been committed on its own
+    unwind_block(tree, roots.size());
+    check_block_height(tree, roots.size() - 1);
+    check_root(tree, roots[roots.size() - 2], false);
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_varying_size_blocks)
 {
     constexpr size_t depth = 10;
@@ -200,6 +200,8 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
 
     void sparse_batch_update(const std::vector<std::pair<index_t, fr>>& hashes_at_level, uint32_t level);
 
+    fr sparse_hash_level(std::vector<index_t>& indices, std::unordered_map<index_t, fr>& hashes, uint32_t level);
+
     /**
      * @brief Adds or updates the given set of values in the tree
      * @param values The values to be added or updated
@@ -1169,13 +1171,6 @@ template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
     const std::vector<std::pair<index_t, fr>>& hashes_at_level, uint32_t level)
 {
-    auto get_optional_node = [&](uint32_t level, index_t index) -> std::optional<fr> {
-        fr value = fr::zero();
-
-        bool success = store_->get_cached_node_by_index(level, index, value);
-        // std::cout << "Getting node at " << level << " : " << index << " success " << success << std::endl;
-        return success ? std::optional<fr>(value) : std::nullopt;
-    };
     std::vector<index_t> indices;
     indices.reserve(hashes_at_level.size());
     std::unordered_map<index_t, fr> hashes;
@@ -1187,51 +1182,77 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
         indices.push_back(index);
         // std::cout << "index " << index << " hash " << hash << std::endl;
     }
-    std::unordered_set<index_t> unique_indices;
     while (level > 0) {
-        std::vector<index_t> next_indices;
-        std::unordered_map<index_t, fr> next_hashes;
-        for (size_t i = 0; i < indices.size(); ++i) {
-            index_t index = indices[i];
-            index_t parent_index = index >> 1;
-            auto it = unique_indices.insert(parent_index);
-            if (!it.second) {
-                continue;
-            }
-            next_indices.push_back(parent_index);
-            bool is_right = static_cast<bool>(index & 0x01);
-            fr new_hash = hashes[index];
-            std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
-            std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
-            fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
-        }
-        indices = std::move(next_indices);
-        hashes = std::move(next_hashes);
-        unique_indices.clear();
+        sparse_hash_level(indices, hashes, level);
         --level;
     }
 }
 
+/**
+ * @brief Hashes the nodes at the given indices of a level, with their siblings, into their parents on the level above
+ * @details The parents are hashed together with HashingPolicy::hash_pairs once the siblings of the whole level have
+ * been read, then written to the store. indices and hashes are replaced by those of the parents.
+ * @return The hash of the last parent
+ */
 template <typename Store, typename HashingPolicy>
-std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
-    const index_t& start_index,
-    const index_t& num_leaves_to_be_inserted,
-    const uint32_t& root_level,
-    const std::vector<LeafInsertion>& insertions)
+fr ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_hash_level(std::vector<index_t>& indices,
+                                                                        std::unordered_map<index_t, fr>& hashes,
+                                                                        uint32_t level)
 {
     auto get_optional_node = [&](uint32_t level, index_t index) -> std::optional<fr> {
         fr value = fr::zero();
-        // std::cout << "Getting node at " << level << " : " << index << std::endl;
         bool success = store_->get_cached_node_by_index(level, index, value);
         return success ? std::optional<fr>(value) : std::nullopt;
     };
 
+    std::unordered_set<index_t> unique_indices;
+    std::vector<index_t> next_indices;
+    std::vector<std::optional<fr>> left_options;
+    std::vector<std::optional<fr>> right_options;
+    std::vector<fr> children;
+    next_indices.reserve(indices.size());
+    left_options.reserve(indices.size());
+    right_options.reserve(indices.size());
+    children.reserve(indices.size() * 2);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        index_t index = indices[i];
+        index_t parent_index = index >> 1;
+        auto it = unique_indices.insert(parent_index);
+        if (!it.second) {
+            continue;
+        }
+        next_indices.push_back(parent_index);
+        bool is_right = static_cast<bool>(index & 0x01);
+        fr new_hash = hashes[index];
+        std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
+        std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
+        children.push_back(new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level]);
+        children.push_back(new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level]);
+        left_options.push_back(new_left_option);
+        right_options.push_back(new_right_option);
+    }
+
+    std::vector<fr> parent_hashes(next_indices.size());
+    HashingPolicy::hash_pairs(children, parent_hashes);
+
+    std::unordered_map<index_t, fr> next_hashes;
+    for (size_t i = 0; i < next_indices.size(); ++i) {
+        store_->put_cached_node_by_index(level - 1, next_indices[i], parent_hashes[i]);
+        store_->put_node_by_hash(parent_hashes[i], { .left = left_options[i], .right = right_options[i], .ref = 1 });
+        next_hashes[next_indices[i]] = parent_hashes[i];
+    }
+    indices = std::move(next_indices);
+    hashes = std::move(next_hashes);
+    return parent_hashes.empty() ? fr::zero() : parent_hashes.back();
+}
+
+template <typename Store, typename HashingPolicy>
+std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_batch_update(
+    const index_t& start_index,
+    const index_t& num_leaves_to_be_inserted,
+    const uint32_t& root_level,
+    const std::vector<LeafInsertion>& insertions)
+{
     uint32_t level = depth_;
 
     std::vector<index_t> indices;
@@ -1239,7 +1260,6 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
 
     fr new_hash = fr::zero();
 
-    std::unordered_set<index_t> unique_indices;
     std::unordered_map<index_t, fr> hashes;
     index_t end_index = start_index + num_leaves_to_be_inserted;
     // Insert the leaves
@@ -1272,33 +1292,7 @@ std::pair<bool, fr> ContentAddressedIndexedTree<Store, HashingPolicy>::sparse_ba
     }
 
     while (level > root_level) {
-        std::vector<index_t> next_indices;
-        std::unordered_map<index_t, fr> next_hashes;
-        for (size_t i = 0; i < indices.size(); ++i) {
-            index_t index = indices[i];
-            index_t parent_index = index >> 1;
-            auto it = unique_indices.insert(parent_index);
-            if (!it.second) {
-                continue;
-            }
-            next_indices.push_back(parent_index);
-            bool is_right = static_cast<bool>(index & 0x01);
-            new_hash = hashes[index];
-            std::optional<fr> new_right_option = is_right ? new_hash : get_optional_node(level, index + 1);
-            std::optional<fr> new_left_option = is_right ? get_optional_node(level, index - 1) : new_hash;
-            fr new_right_value = new_right_option.has_value() ? new_right_option.value() : zero_hashes_[level];
-            fr new_left_value = new_left_option.has_value() ? new_left_option.value() : zero_hashes_[level];
-
-            new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-            store_->put_cached_node_by_index(level - 1, parent_index, new_hash);
-            store_->put_node_by_hash(new_hash, { .left = new_left_option, .right = new_right_option, .ref = 1 });
-            next_hashes[parent_index] = new_hash;
-            // std::cout << "Created parent hash at level " << level - 1 << " index " << parent_index << " hash "
-            //           << new_hash << " left " << new_left_value << " right " << new_right_value << std::endl;
-        }
-        indices = std::move(next_indices);
-        hashes = std::move(next_hashes);
-        unique_indices.clear();
+        new_hash = sparse_hash_level(indices, hashes, level);
         --level;
     }
     // std::cout << "Returning hash " << new_hash << std::endl;
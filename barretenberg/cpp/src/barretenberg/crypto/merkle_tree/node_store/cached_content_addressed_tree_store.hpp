@@ -1,4 +1,6 @@
 #pragma once
+#include "./chunked_sorted_map.hpp"
+#include "./flat_hash_map.hpp"
 #include "./tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
@@ -12,12 +14,13 @@
 #include "msgpack/assert.hpp"
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
-#include <unordered_map>
+#include <string>
 #include <utility>
 
 template <> struct std::hash<uint256_t> {
@@ -169,6 +172,12 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     void commit(bool asBlock = true);
 
+    /**
+     * @brief Records the uncommitted state as a block. The next commit writes every recorded block, each with its own
+     * root and size, in the same transaction as the rest of the uncommitted state
+     */
+    void checkpoint_block();
+
     /**
      * @brief Rolls back the uncommitted state
      */
@@ -212,23 +221,26 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     // This is a mapping between the node hash and it's payload (children and ref count) for every node in the tree,
     // including leaves. As indexed trees are updated, this will end up containing many nodes that are not part of the
     // final tree so they need to be omitted from what is committed.
-    std::unordered_map<fr, NodePayload> nodes_;
+    FlatHashMap<fr, NodePayload> nodes_;
 
     // This is a store mapping the leaf key (e.g. slot for public data or nullifier value for nullifier tree) to the
     // indices in the tree For indexed tress there is only ever one index against the key, for append-only trees there
     // can be multiple
-    std::map<uint256_t, Indices> indices_;
+    ChunkedSortedMap<uint256_t, Indices> indices_;
 
     // This is a mapping from leaf hash to leaf pre-image. This will contain entries that need to be omitted when
     // commiting updates
-    std::unordered_map<fr, IndexedLeafValueType> leaves_;
+    FlatHashMap<fr, IndexedLeafValueType> leaves_;
     PersistedStoreType::SharedPtr dataStore_;
     TreeMeta meta_;
     mutable std::mutex mtx_;
 
     // The following stores are not persisted, just cached until commit
-    std::vector<std::unordered_map<index_t, fr>> nodes_by_index_;
-    std::unordered_map<index_t, IndexedLeafValueType> leaf_pre_image_by_index_;
+    std::vector<FlatHashMap<index_t, fr>> nodes_by_index_;
+    FlatHashMap<index_t, IndexedLeafValueType> leaf_pre_image_by_index_;
+
+    // The blocks recorded since the last commit, see checkpoint_block
+    std::vector<BlockPayload> pending_blocks_;
 
     void initialise();
 
@@ -273,7 +285,7 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
     : name_(std::move(name))
     , depth_(levels)
     , dataStore_(dataStore)
-    , nodes_by_index_(std::vector<std::unordered_map<index_t, fr>>(depth_ + 1, std::unordered_map<index_t, fr>()))
+    , nodes_by_index_(std::vector<FlatHashMap<index_t, fr>>(depth_ + 1))
 {
     initialise();
 }
@@ -286,7 +298,7 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
     : name_(std::move(name))
     , depth_(levels)
     , dataStore_(dataStore)
-    , nodes_by_index_(std::vector<std::unordered_map<index_t, fr>>(depth_ + 1, std::unordered_map<index_t, fr>()))
+    , nodes_by_index_(std::vector<FlatHashMap<index_t, fr>>(depth_ + 1))
 {
     initialise_from_block(referenceBlockNumber);
 }
@@ -329,31 +341,22 @@ std::pair<bool, index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_lo
     }
 
     // At this stage, we have been asked to include uncommitted and the value was not exactly found in the db
-    auto it = indices_.lower_bound(new_value_as_number);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        // we need to return the larger of the db value or the cached value
-
-        return std::make_pair(false, it->first > retrieved_value ? it->second.indices[0] : db_index);
+    // Find the largest cached value <= the requested value
+    const auto* entry = indices_.find_floor(new_value_as_number);
+    if (entry == nullptr) {
+        // No cached lower value, return the db index
+        return std::make_pair(false, db_index);
     }
 
-    if (it->first == uint256_t(new_value_as_number)) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second.indices[0]);
+    if (entry->first == new_value_as_number) {
+        // the value is already present
+        return std::make_pair(true, entry->second.indices[0]);
     }
-    // the iterator points to the element immediately larger than the requested value
+    // entry is the value less than that requested
     // We need to return the highest value from
-    // 1. The next lowest cached value, if there is one
+    // 1. The next lowest cached value
     // 2. The value retrieved from the db
-    if (it == indices_.begin()) {
-        // No cached lower value, return the db index
-        return std::make_pair(false, db_index);
-    }
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->first > retrieved_value ? it->second.indices[0] : db_index);
+    return std::make_pair(false, entry->first > retrieved_value ? entry->second.indices[0] : db_index);
 }
 
 template <typename LeafValueType>
@@ -366,9 +369,9 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_
     if (includeUncommitted) {
         // Accessing leaves_ here under a lock
         std::unique_lock lock(mtx_);
-        typename std::unordered_map<fr, IndexedLeafValueType>::const_iterator it = leaves_.find(leaf_hash);
-        if (it != leaves_.end()) {
-            leaf = it->second;
+        const IndexedLeafValueType* cached = leaves_.find(leaf_hash);
+        if (cached != nullptr) {
+            leaf = *cached;
             return leaf;
         }
     }
@@ -395,11 +398,11 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_cached_leaf_by_index(const i
 {
     // Accessing leaf_pre_image_by_index_ under a lock
     std::unique_lock lock(mtx_);
-    auto it = leaf_pre_image_by_index_.find(index);
-    if (it == leaf_pre_image_by_index_.end()) {
+    const IndexedLeafValueType* cached = leaf_pre_image_by_index_.find(index);
+    if (cached == nullptr) {
         return std::nullopt;
     }
-    return it->second;
+    return *cached;
 }
 
 template <typename LeafValueType>
@@ -425,14 +428,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::update_index(const index_t&
     // std::cout << "update_index at index " << index << " leaf " << leaf << std::endl;
     //  Accessing indices_ under a lock
     std::unique_lock lock(mtx_);
-    auto it = indices_.find(uint256_t(leaf));
-    if (it == indices_.end()) {
-        Indices ind;
-        ind.indices.push_back(index);
-        indices_[uint256_t(leaf)] = ind;
-        return;
-    }
-    it->second.indices.push_back(index);
+    indices_[uint256_t(leaf)].indices.push_back(index);
 }
 
 template <typename LeafValueType>
@@ -476,9 +472,9 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
     if (includeUncommitted) {
         // Accessing indices_ under a lock
         std::unique_lock lock(mtx_);
-        auto it = indices_.find(uint256_t(leaf));
-        if (it != indices_.end() && !it->second.indices.empty()) {
-            for (index_t ind : it->second.indices) {
+        const Indices* cached = indices_.find(uint256_t(leaf));
+        if (cached != nullptr && !cached->indices.empty()) {
+            for (index_t ind : cached->indices) {
                 if (ind < start_index) {
                     continue;
                 }
@@ -510,9 +506,9 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
     if (includeUncommitted) {
         // Accessing nodes_ under a lock
         std::unique_lock lock(mtx_);
-        auto it = nodes_.find(nodeHash);
-        if (it != nodes_.end()) {
-            payload = it->second;
+        const NodePayload* cached = nodes_.find(nodeHash);
+        if (cached != nullptr) {
+            payload = *cached;
             return true;
         }
     }
@@ -527,12 +523,8 @@ void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_node_by_index(ui
 {
     // Accessing nodes_by_index_ under a lock
     std::unique_lock lock(mtx_);
-    if (!overwriteIfPresent) {
-        const auto& level_map = nodes_by_index_[level];
-        auto it = level_map.find(index);
-        if (it != level_map.end()) {
-            return;
-        }
+    if (!overwriteIfPresent && nodes_by_index_[level].contains(index)) {
+        return;
     }
 
     nodes_by_index_[level][index] = data;
@@ -545,12 +537,11 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_cached_node_by_index(ui
 {
     // Accessing nodes_by_index_ under a lock
     std::unique_lock lock(mtx_);
-    const auto& level_map = nodes_by_index_[level];
-    auto it = level_map.find(index);
-    if (it == level_map.end()) {
+    const fr* cached = nodes_by_index_[level].find(index);
+    if (cached == nullptr) {
         return false;
     }
-    data = it->second;
+    data = *cached;
     return true;
 }
 
@@ -622,6 +613,23 @@ fr ContentAddressedCachedTreeStore<LeafValueType>::get_current_root(ReadTransact
 // It is assumed that when these operations are being executed that no other state accessing operations
 // are in progress, hence no data synchronisation is used.
 
+template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::checkpoint_block()
+{
+    // We don't allow commits using images/forks
+    if (initialised_from_block_.has_value()) {
+        throw std::runtime_error("Checkpointing a fork is forbidden");
+    }
+    // Every update appends to the tree, so a block that leaves the size as it was has no changes, in which case
+    // we don't record a block (as for a commit with nothing to commit)
+    index_t previous_size = pending_blocks_.empty() ? meta_.committedSize : pending_blocks_.back().size;
+    if (meta_.size == previous_size) {
+        return;
+    }
+    pending_blocks_.push_back(BlockPayload{ .size = meta_.size,
+                                            .blockNumber = meta_.unfinalisedBlockHeight + pending_blocks_.size() + 1,
+                                            .root = meta_.root });
+}
+
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::commit(bool asBlock)
 {
     bool dataPresent = false;
@@ -642,8 +650,7 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
         if (!metaToCommit) {
             return;
         }
-        auto currentRootIter = nodes_.find(uncommittedMeta.root);
-        dataPresent = currentRootIter != nodes_.end();
+        dataPresent = nodes_.contains(uncommittedMeta.root);
         if (!dataPresent) {
             // no uncommitted data present, if we were asked to commit as a block then we can't
             if (asBlock) {
@@ -661,17 +668,34 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
                 // std::cout << "Persisting data for block " << uncommittedMeta.unfinalisedBlockHeight + 1 << std::endl;
                 persist_leaf_indices(*tx);
                 persist_leaf_keys(uncommittedMeta.committedSize, *tx);
-                persist_node(std::optional<fr>(uncommittedMeta.root), 0, *tx);
-                if (asBlock) {
+                auto write_block = [&](index_t size, const fr& root) {
                     ++uncommittedMeta.unfinalisedBlockHeight;
                     if (uncommittedMeta.oldestHistoricBlock == 0) {
                         uncommittedMeta.oldestHistoricBlock = 1;
                     }
-                    // std::cout << "New root " << uncommittedMeta.root << std::endl;
-                    BlockPayload block{ .size = uncommittedMeta.size,
-                                        .blockNumber = uncommittedMeta.unfinalisedBlockHeight,
-                                        .root = uncommittedMeta.root };
+                    // std::cout << "New root " << root << std::endl;
+                    BlockPayload block{
+                        .size = size, .blockNumber = uncommittedMeta.unfinalisedBlockHeight, .root = root
+                    };
                     dataStore_->write_block_data(uncommittedMeta.unfinalisedBlockHeight, block, *tx);
+                };
+                // The nodes shared by consecutive blocks are only written once, the later blocks just add references
+                for (const BlockPayload& block : pending_blocks_) {
+                    if (block.blockNumber != uncommittedMeta.unfinalisedBlockHeight + 1) {
+                        throw std::runtime_error("Checkpointed block " + std::to_string(block.blockNumber) +
+                                                 " would be committed as block " +
+                                                 std::to_string(uncommittedMeta.unfinalisedBlockHeight + 1));
+                    }
+                    persist_node(std::optional<fr>(block.root), 0, *tx);
+                    write_block(block.size, block.root);
+                }
+                bool lastBlockIsPending =
+                    !pending_blocks_.empty() && pending_blocks_.back().size == uncommittedMeta.size;
+                if (!lastBlockIsPending) {
+                    persist_node(std::optional<fr>(uncommittedMeta.root), 0, *tx);
+                    if (asBlock) {
+                        write_block(uncommittedMeta.size, uncommittedMeta.root);
+                    }
                 }
             }
             uncommittedMeta.committedSize = uncommittedMeta.size;
@@ -690,38 +714,38 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
 {
-    for (auto& idx : indices_) {
-        FrKeyType key = idx.first;
-        dataStore_->write_leaf_indices(key, idx.second, tx);
-    }
+    indices_.for_each([&](const uint256_t& leaf, const Indices& indices) {
+        FrKeyType key = leaf;
+        dataStore_->write_leaf_indices(key, indices, tx);
+    });
 }
 
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_keys(index_t startIndex, WriteTransaction& tx)
 {
-    for (auto& idx : indices_) {
-        FrKeyType key = idx.first;
+    indices_.for_each([&](const uint256_t& leaf, const Indices& indices) {
+        FrKeyType key = leaf;
 
         // write the leaf key against the indices, this is for the pending chain store of indices
-        for (index_t indexForKey : idx.second.indices) {
+        for (index_t indexForKey : indices.indices) {
             if (indexForKey < startIndex) {
                 continue;
             }
             dataStore_->write_leaf_key_by_index(key, indexForKey, tx);
         }
-    }
+    });
 }
 
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_pre_image(const fr& hash, WriteTransaction& tx)
 {
     // Now persist the leaf pre-image
-    auto leafPreImageIter = leaves_.find(hash);
-    if (leafPreImageIter == leaves_.end()) {
+    const IndexedLeafValueType* leafPreImage = leaves_.find(hash);
+    if (leafPreImage == nullptr) {
         return;
     }
-    // std::cout << "Persisting leaf preimage " << leafPreImageIter->second << std::endl;
-    dataStore_->write_leaf_by_hash(hash, leafPreImageIter->second, tx);
+    // std::cout << "Persisting leaf preimage " << *leafPreImage << std::endl;
+    dataStore_->write_leaf_by_hash(hash, *leafPreImage, tx);
 }
 
 template <typename LeafValueType>
@@ -744,36 +768,35 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
 
     // std::cout << "Persisting node hash " << hash << " at level " << level << std::endl;
 
-    auto nodePayloadIter = nodes_.find(hash);
-    if (nodePayloadIter == nodes_.end()) {
+    const NodePayload* nodePayload = nodes_.find(hash);
+    if (nodePayload == nullptr) {
         //  need to increase the stored node's reference count here
         dataStore_->increment_node_reference_count(hash, tx);
         return;
     }
-    NodePayload nodeData = nodePayloadIter->second;
+    NodePayload nodeData = *nodePayload;
     dataStore_->set_or_increment_node_reference_count(hash, nodeData, tx);
     if (nodeData.ref != 1) {
         // If the node now has a ref count greater then 1, we don't continue.
         // It means that the entire sub-tree underneath already exists
         return;
     }
-    persist_node(nodePayloadIter->second.left, level + 1, tx);
-    persist_node(nodePayloadIter->second.right, level + 1, tx);
+    persist_node(nodePayload->left, level + 1, tx);
+    persist_node(nodePayload->right, level + 1, tx);
 }
 
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::hydrate_indices_from_persisted_store(ReadTransaction& tx)
 {
-    for (auto& idx : indices_) {
-        std::vector<uint8_t> value;
-        FrKeyType key = idx.first;
+    indices_.for_each([&](const uint256_t& leaf, Indices& indices) {
+        FrKeyType key = leaf;
         Indices persistedIndices;
         bool success = dataStore_->read_leaf_indices(key, persistedIndices, tx);
         if (success) {
-            idx.second.indices.insert(
-                idx.second.indices.begin(), persistedIndices.indices.begin(), persistedIndices.indices.end());
+            indices.indices.insert(
+                indices.indices.begin(), persistedIndices.indices.begin(), persistedIndices.indices.end());
         }
-    }
+    });
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::rollback()
@@ -783,11 +806,12 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
         ReadTransactionPtr tx = create_read_transaction();
         read_persisted_meta(meta_, *tx);
     }
-    nodes_ = std::unordered_map<fr, NodePayload>();
-    indices_ = std::map<uint256_t, Indices>();
-    leaves_ = std::unordered_map<fr, IndexedLeafValueType>();
-    nodes_by_index_ = std::vector<std::unordered_map<index_t, fr>>(depth_ + 1, std::unordered_map<index_t, fr>());
-    leaf_pre_image_by_index_ = std::unordered_map<index_t, IndexedLeafValueType>();
+    nodes_.clear();
+    indices_.clear();
+    leaves_.clear();
+    nodes_by_index_ = std::vector<FlatHashMap<index_t, fr>>(depth_ + 1);
+    leaf_pre_image_by_index_.clear();
+    pending_blocks_.clear();
 }
 
 template <typename LeafValueType>
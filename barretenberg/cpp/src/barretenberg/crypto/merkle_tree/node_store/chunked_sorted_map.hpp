@@ -0,0 +1,147 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief An ordered map kept as a sequence of sorted chunks, i.e. a B+tree with a single level of internal nodes
+ * @details Each chunk is a sorted array of at most MAX_CHUNK_SIZE entries, and the first key of every chunk is kept in
+ * a separate sorted array. A lookup is a binary search over those first keys followed by a binary search within one
+ * chunk, so it touches a few contiguous cache lines rather than chasing the pointers of a red-black tree. An insertion
+ * shifts the entries of one chunk and splits it in two once it is full.
+ */
+template <typename Key, typename Value> class ChunkedSortedMap {
+  public:
+    using Entry = std::pair<Key, Value>;
+
+    ChunkedSortedMap() = default;
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const Value* find(const Key& key) const
+    {
+        if (chunks_.empty()) {
+            return nullptr;
+        }
+        const std::vector<Entry>& chunk = chunks_[find_chunk(key)];
+        auto it = lower_bound(chunk, key);
+        return it != chunk.end() && it->first == key ? &it->second : nullptr;
+    }
+
+    Value* find(const Key& key) { return const_cast<Value*>(static_cast<const ChunkedSortedMap&>(*this).find(key)); }
+
+    /**
+     * @brief Returns the entry with the largest key that is less than or equal to the given key, if there is one
+     */
+    const Entry* find_floor(const Key& key) const
+    {
+        if (chunks_.empty()) {
+            return nullptr;
+        }
+        const std::vector<Entry>& chunk = chunks_[find_chunk(key)];
+        auto it = std::upper_bound(
+            chunk.begin(), chunk.end(), key, [](const Key& k, const Entry& entry) { return k < entry.first; });
+        // only the first chunk can start with a key larger than the one requested
+        return it == chunk.begin() ? nullptr : &*std::prev(it);
+    }
+
+    /**
+     * @brief Returns the value for the key, inserting a default constructed one if it is not present
+     * @details The reference is invalidated by the next insertion.
+     */
+    Value& operator[](const Key& key)
+    {
+        if (chunks_.empty()) {
+            chunks_.emplace_back().reserve(MAX_CHUNK_SIZE + 1);
+            first_keys_.push_back(key);
+        }
+        const size_t chunk_index = find_chunk(key);
+        std::vector<Entry>& chunk = chunks_[chunk_index];
+        auto it = lower_bound(chunk, key);
+        if (it != chunk.end() && it->first == key) {
+            return it->second;
+        }
+        auto position = static_cast<size_t>(std::distance(chunk.begin(), it));
+        chunk.insert(it, Entry{ key, Value() });
+        ++size_;
+        if (position == 0) {
+            first_keys_[chunk_index] = key;
+        }
+        if (chunk.size() <= MAX_CHUNK_SIZE) {
+            return chunk[position].second;
+        }
+
+        // The chunk is full, move its upper half into a new chunk after it
+        const size_t half = chunk.size() / 2;
+        std::vector<Entry> upper;
+        upper.reserve(MAX_CHUNK_SIZE + 1);
+        std::move(chunk.begin() + static_cast<std::ptrdiff_t>(half), chunk.end(), std::back_inserter(upper));
+        chunk.resize(half);
+        first_keys_.insert(first_keys_.begin() + static_cast<std::ptrdiff_t>(chunk_index) + 1, upper.front().first);
+        chunks_.insert(chunks_.begin() + static_cast<std::ptrdiff_t>(chunk_index) + 1, std::move(upper));
+        if (position < half) {
+            return chunks_[chunk_index][position].second;
+        }
+        return chunks_[chunk_index + 1][position - half].second;
+    }
+
+    /**
+     * @brief Removes every entry and releases the memory
+     */
+    void clear()
+    {
+        first_keys_ = std::vector<Key>();
+        chunks_ = std::vector<std::vector<Entry>>();
+        size_ = 0;
+    }
+
+    /**
+     * @brief Calls f(key, value) for every entry, in increasing order of key
+     */
+    template <typename F> void for_each(F&& f)
+    {
+        for (std::vector<Entry>& chunk : chunks_) {
+            for (Entry& entry : chunk) {
+                f(static_cast<const Key&>(entry.first), entry.second);
+            }
+        }
+    }
+
+    template <typename F> void for_each(F&& f) const
+    {
+        for (const std::vector<Entry>& chunk : chunks_) {
+            for (const Entry& entry : chunk) {
+                f(entry.first, entry.second);
+            }
+        }
+    }
+
+  private:
+    static constexpr size_t MAX_CHUNK_SIZE = 128;
+
+    std::vector<Key> first_keys_;
+    std::vector<std::vector<Entry>> chunks_;
+    size_t size_ = 0;
+
+    /**
+     * @brief Returns the last chunk whose first key is less than or equal to the given key, or the first chunk
+     */
+    size_t find_chunk(const Key& key) const
+    {
+        auto it = std::upper_bound(first_keys_.begin(), first_keys_.end(), key);
+        return it == first_keys_.begin() ? 0 : static_cast<size_t>(std::distance(first_keys_.begin(), it)) - 1;
+    }
+
+    template <typename Chunk> static auto lower_bound(Chunk& chunk, const Key& key)
+    {
+        return std::lower_bound(
+            chunk.begin(), chunk.end(), key, [](const Entry& entry, const Key& k) { return entry.first < k; });
+    }
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,82 @@
+#include "chunked_sorted_map.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <map>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+} // namespace
+
+TEST(ChunkedSortedMapTest, matches_std_map)
+{
+    ChunkedSortedMap<uint256_t, uint64_t> map;
+    std::map<uint256_t, uint64_t> expected;
+    for (uint64_t i = 0; i < 10000; ++i) {
+        // draw from a small range so that keys repeat and every chunk is split many times
+        uint256_t key = engine.get_random_uint64() % 8192;
+        map[key] += i;
+        expected[key] += i;
+        EXPECT_EQ(map.size(), expected.size());
+    }
+
+    for (uint256_t key = 0; key < 9000; key += 1) {
+        auto it = expected.find(key);
+        const uint64_t* value = map.find(key);
+        if (it == expected.end()) {
+            EXPECT_EQ(value, nullptr);
+        } else {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(*value, it->second);
+        }
+
+        // the floor is the largest key <= the one requested
+        auto floor = expected.upper_bound(key);
+        const auto* entry = map.find_floor(key);
+        if (floor == expected.begin()) {
+            EXPECT_EQ(entry, nullptr);
+        } else {
+            --floor;
+            ASSERT_NE(entry, nullptr);
+            EXPECT_EQ(entry->first, floor->first);
+            EXPECT_EQ(entry->second, floor->second);
+        }
+    }
+
+    auto it = expected.begin();
+    map.for_each([&](const uint256_t& key, const uint64_t& value) {
+        ASSERT_NE(it, expected.end());
+        EXPECT_EQ(key, it->first);
+        EXPECT_EQ(value, it->second);
+        ++it;
+    });
+    EXPECT_EQ(it, expected.end());
+}
+
+TEST(ChunkedSortedMapTest, can_insert_in_descending_order)
+{
+    ChunkedSortedMap<uint256_t, uint64_t> map;
+    for (uint64_t i = 1000; i > 0; --i) {
+        map[i] = i;
+    }
+    EXPECT_EQ(map.size(), 1000);
+    EXPECT_EQ(map.find_floor(0), nullptr);
+    EXPECT_EQ(map.find_floor(1)->second, 1);
+    EXPECT_EQ(map.find_floor(5000)->second, 1000);
+
+    uint64_t previous = 0;
+    map.for_each([&](const uint256_t& key, uint64_t& value) {
+        EXPECT_EQ(key, previous + 1);
+        previous = value;
+    });
+    EXPECT_EQ(previous, 1000);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(5), nullptr);
+    EXPECT_EQ(map.find_floor(5), nullptr);
+}
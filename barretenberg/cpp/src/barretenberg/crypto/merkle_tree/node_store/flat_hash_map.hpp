@@ -0,0 +1,187 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief An insert-only hash map for the caches of the tree stores
+ * @details The entries are stored in insertion order, in blocks of doubling size, so they never move once inserted
+ * and no memory is set aside for entries that are not there yet. They are found through an open-addressed table with
+ * linear probing of 8 byte slots, each holding 32 bits of the key's hash and the position of the entry: a probe
+ * touches a single cache line of the table and, unless the hashes match, no entry. Growing the table only moves the
+ * slots. The hash of the key is mixed before use, so sequential integer keys spread as well as field elements do.
+ * Entries are never removed individually; the map is only ever cleared as a whole.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>> class FlatHashMap {
+  public:
+    using Entry = std::pair<Key, Value>;
+
+    FlatHashMap() = default;
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const Value* find(const Key& key) const
+    {
+        if (size_ == 0) {
+            return nullptr;
+        }
+        auto [slot, found] = find_slot(key, mix(key));
+        return found ? &entry(slots_[slot].index).second : nullptr;
+    }
+
+    Value* find(const Key& key) { return const_cast<Value*>(static_cast<const FlatHashMap&>(*this).find(key)); }
+
+    bool contains(const Key& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief Returns the value for the key, inserting a default constructed one if it is not present
+     * @details The reference stays valid until the map is cleared.
+     */
+    Value& operator[](const Key& key)
+    {
+        if ((size_ + 1) * MAX_LOAD_DENOMINATOR > slots_.size() * MAX_LOAD_NUMERATOR) {
+            rehash(slots_.empty() ? MIN_CAPACITY : slots_.size() * 2);
+        }
+        const uint64_t hash = mix(key);
+        auto [slot, found] = find_slot(key, hash);
+        if (found) {
+            return entry(slots_[slot].index).second;
+        }
+        if (size_ == std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("FlatHashMap is full");
+        }
+        slots_[slot] = Slot{ .tag = tag(hash), .index = static_cast<uint32_t>(size_) };
+        return append(key).second;
+    }
+
+    void reserve(size_t num_entries)
+    {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity * MAX_LOAD_NUMERATOR < num_entries * MAX_LOAD_DENOMINATOR) {
+            capacity *= 2;
+        }
+        if (capacity > slots_.size()) {
+            rehash(capacity);
+        }
+    }
+
+    /**
+     * @brief Removes every entry and releases the memory
+     */
+    void clear()
+    {
+        slots_ = std::vector<Slot>();
+        blocks_ = std::vector<std::vector<Entry>>();
+        size_ = 0;
+        shift_ = 64;
+    }
+
+    /**
+     * @brief Calls f(key, value) for every entry, in insertion order
+     */
+    template <typename F> void for_each(F&& f) const
+    {
+        for (const std::vector<Entry>& block : blocks_) {
+            for (const Entry& e : block) {
+                f(e.first, e.second);
+            }
+        }
+    }
+
+  private:
+    static constexpr size_t MIN_CAPACITY = 16;
+    static constexpr size_t MIN_BLOCK_SIZE = 16;
+    // The table grows once it is more than 7/8 full
+    static constexpr size_t MAX_LOAD_NUMERATOR = 7;
+    static constexpr size_t MAX_LOAD_DENOMINATOR = 8;
+
+    struct Slot {
+        // 32 bits of the hash of the key, with the lowest bit set, or 0 if the slot is empty
+        uint32_t tag = 0;
+        uint32_t index = 0;
+    };
+
+    std::vector<Slot> slots_;
+    // Block 0 and block 1 hold MIN_BLOCK_SIZE entries, every later block twice as many as the one before
+    std::vector<std::vector<Entry>> blocks_;
+    size_t size_ = 0;
+    // The home slot of a hash is given by its top log2(capacity) bits
+    uint32_t shift_ = 64;
+
+    static uint64_t mix(const Key& key)
+    {
+        // Fibonacci hashing, the high bits of the product depend on all the bits of the hash
+        return static_cast<uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    static uint32_t tag(uint64_t hash) { return static_cast<uint32_t>(hash) | 1; }
+
+    const Entry& entry(size_t index) const
+    {
+        if (index < MIN_BLOCK_SIZE) {
+            return blocks_[0][index];
+        }
+        const size_t block = static_cast<size_t>(std::bit_width(index / MIN_BLOCK_SIZE));
+        return blocks_[block][index - (MIN_BLOCK_SIZE << (block - 1))];
+    }
+
+    Entry& entry(size_t index) { return const_cast<Entry&>(static_cast<const FlatHashMap&>(*this).entry(index)); }
+
+    static size_t block_size(size_t block) { return block < 2 ? MIN_BLOCK_SIZE : MIN_BLOCK_SIZE << (block - 1); }
+
+    Entry& append(const Key& key)
+    {
+        // reserve() may give a block more capacity than asked for, so its fill is checked against its own size: an
+        // entry past it would not be where entry() looks for it
+        if (blocks_.empty() || blocks_.back().size() == block_size(blocks_.size() - 1)) {
+            const size_t new_block_size = block_size(blocks_.size());
+            blocks_.emplace_back().reserve(new_block_size);
+        }
+        ++size_;
+        return blocks_.back().emplace_back(key, Value());
+    }
+
+    /**
+     * @brief Returns the slot holding the key if it is present, otherwise the empty slot it would be inserted into
+     */
+    std::pair<size_t, bool> find_slot(const Key& key, uint64_t hash) const
+    {
+        const uint32_t key_tag = tag(hash);
+        const size_t mask = slots_.size() - 1;
+        for (size_t slot = static_cast<size_t>(hash >> shift_);; slot = (slot + 1) & mask) {
+            const Slot& s = slots_[slot];
+            if (s.tag == 0) {
+                return { slot, false };
+            }
+            if (s.tag == key_tag && entry(s.index).first == key) {
+                return { slot, true };
+            }
+        }
+    }
+
+    void rehash(size_t capacity)
+    {
+        slots_ = std::vector<Slot>(capacity);
+        shift_ = static_cast<uint32_t>(64 - std::countr_zero(capacity));
+        // Every key is distinct, so each entry goes in the first empty slot from its home slot
+        const size_t mask = capacity - 1;
+        for (size_t index = 0; index < size_; ++index) {
+            const uint64_t hash = mix(entry(index).first);
+            size_t slot = static_cast<size_t>(hash >> shift_);
+            while (slots_[slot].tag != 0) {
+                slot = (slot + 1) & mask;
+            }
+            slots_[slot] = Slot{ .tag = tag(hash), .index = static_cast<uint32_t>(index) };
+        }
+    }
+};
+
+} // namespace bb::crypto::merkle_tree
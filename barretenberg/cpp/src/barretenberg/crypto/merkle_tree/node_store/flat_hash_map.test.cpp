@@ -0,0 +1,82 @@
+#include "flat_hash_map.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <unordered_map>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+struct FieldHash {
+    size_t operator()(const fr& value) const { return static_cast<size_t>(uint256_t(value).data[0]); }
+};
+} // namespace
+
+TEST(FlatHashMapTest, matches_unordered_map)
+{
+    FlatHashMap<uint64_t, uint64_t> map;
+    std::unordered_map<uint64_t, uint64_t> expected;
+    for (uint64_t i = 0; i < 10000; ++i) {
+        // draw from a small range so that keys repeat
+        uint64_t key = engine.get_random_uint64() % 4096;
+        map[key] += i;
+        expected[key] += i;
+        EXPECT_EQ(map.size(), expected.size());
+    }
+    for (uint64_t key = 0; key < 8192; ++key) {
+        auto it = expected.find(key);
+        const uint64_t* value = map.find(key);
+        if (it == expected.end()) {
+            EXPECT_EQ(value, nullptr);
+            EXPECT_FALSE(map.contains(key));
+        } else {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(*value, it->second);
+        }
+    }
+
+    size_t visited = 0;
+    map.for_each([&](const uint64_t& key, const uint64_t& value) {
+        EXPECT_EQ(expected[key], value);
+        ++visited;
+    });
+    EXPECT_EQ(visited, expected.size());
+}
+
+TEST(FlatHashMapTest, can_store_sequential_indices_and_field_elements)
+{
+    FlatHashMap<uint64_t, fr> by_index;
+    FlatHashMap<fr, uint64_t, FieldHash> by_value;
+    by_index.reserve(1000);
+    for (uint64_t i = 0; i < 1000; ++i) {
+        fr value = fr::random_element(&engine);
+        by_index[i] = value;
+        by_value[value] = i;
+    }
+    for (uint64_t i = 0; i < 1000; ++i) {
+        const fr* value = by_index.find(i);
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(*by_value.find(*value), i);
+    }
+    EXPECT_EQ(by_index.find(1000), nullptr);
+    EXPECT_EQ(by_value.find(fr::random_element(&engine)), nullptr);
+}
+
+TEST(FlatHashMapTest, clear_removes_everything)
+{
+    FlatHashMap<uint64_t, uint64_t> map;
+    for (uint64_t i = 0; i < 100; ++i) {
+        map[i] = i;
+    }
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(5), nullptr);
+    map[5] = 6;
+    EXPECT_EQ(*map.find(5), 6);
+    EXPECT_EQ(map.size(), 1);
+}
@@ -1,4 +1,5 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
 
 namespace bb::crypto {
 /**
@@ -43,5 +44,48 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash_buffer(const std::vector<
     return hash(converted);
 }
 
+/**
+ * @brief Hashes two field elements, equal to hash({ lhs, rhs }) but without allocating or running the sponge
+ * @details Sponge::hash_fixed_length absorbs both inputs into the rate and permutes once, with the capacity holding the
+ * IV that encodes the input length, then squeezes the first element of the state.
+ */
+template <typename Params>
+typename Poseidon2<Params>::FF Poseidon2<Params>::hash_pair(const FF& lhs, const FF& rhs)
+{
+    static_assert(Params::t == 4);
+    const FF iv(uint256_t(2) << 64);
+    return Poseidon2Permutation<Params>::permutation({ lhs, rhs, FF(0), iv })[0];
+}
+
+/**
+ * @brief Hashes the pairs (inputs[2i], inputs[2i + 1]) into outputs[i], interleaving several permutations
+ * @details outputs may alias the front of inputs: each group of lanes reads all of its inputs before writing, and
+ * writes only below the inputs of the following groups.
+ */
+template <typename Params> void Poseidon2<Params>::hash_pairs(std::span<const FF> inputs, std::span<FF> outputs)
+{
+    static_assert(Params::t == 4);
+    using Permutation = Poseidon2Permutation<Params>;
+    constexpr size_t NUM_LANES = 4;
+    ASSERT(inputs.size() == 2 * outputs.size());
+
+    const FF iv(uint256_t(2) << 64);
+    const size_t num_pairs = outputs.size();
+    size_t i = 0;
+    for (; i + NUM_LANES <= num_pairs; i += NUM_LANES) {
+        std::array<typename Permutation::State, NUM_LANES> states;
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            states[lane] = { inputs[2 * (i + lane)], inputs[2 * (i + lane) + 1], FF(0), iv };
+        }
+        Permutation::permutation_lanes(states);
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            outputs[i + lane] = states[lane][0];
+        }
+    }
+    for (; i < num_pairs; ++i) {
+        outputs[i] = hash_pair(inputs[2 * i], inputs[2 * i + 1]);
+    }
+}
+
 template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
 } // namespace bb::crypto
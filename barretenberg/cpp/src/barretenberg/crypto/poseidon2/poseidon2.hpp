@@ -4,6 +4,8 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -22,6 +24,15 @@ template <typename Params> class Poseidon2 {
      * @details Slice function cuts out the required number of bytes from the byte vector
      */
     static FF hash_buffer(const std::vector<uint8_t>& input);
+    /**
+     * @brief Hashes two field elements, equal to hash({ lhs, rhs }) but without allocating or running the sponge
+     */
+    static FF hash_pair(const FF& lhs, const FF& rhs);
+    /**
+     * @brief Hashes the pairs (inputs[2i], inputs[2i + 1]) into outputs[i], interleaving several permutations
+     * @details outputs may alias the front of inputs, e.g. to hash a tree level in place.
+     */
+    static void hash_pairs(std::span<const FF> inputs, std::span<FF> outputs);
 };
 
 extern template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
@@ -64,3 +64,37 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    fr a = fr::random_element(&engine);
+    fr b = fr::random_element(&engine);
+
+    EXPECT_EQ(Poseidon2::hash_pair(a, b), Poseidon2::hash({ a, b }));
+    EXPECT_EQ(Poseidon2::hash_pair(fr::zero(), fr::zero()), Poseidon2::hash({ fr::zero(), fr::zero() }));
+}
+
+TEST(Poseidon2, HashPairsMatchesHashPair)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    // Sizes that do and do not fill the last group of lanes
+    for (size_t num_pairs : { 1, 4, 11 }) {
+        std::vector<fr> inputs(2 * num_pairs);
+        for (auto& input : inputs) {
+            input = fr::random_element(&engine);
+        }
+        std::vector<fr> expected(num_pairs);
+        for (size_t i = 0; i < num_pairs; ++i) {
+            expected[i] = Poseidon2::hash_pair(inputs[2 * i], inputs[2 * i + 1]);
+        }
+
+        std::vector<fr> outputs(num_pairs);
+        Poseidon2::hash_pairs(inputs, outputs);
+        EXPECT_EQ(outputs, expected);
+
+        // In place, writing the parents over the front of the inputs
+        Poseidon2::hash_pairs(inputs, std::span{ inputs.data(), num_pairs });
+        EXPECT_EQ(std::vector<fr>(inputs.begin(), inputs.begin() + static_cast<std::ptrdiff_t>(num_pairs)), expected);
+    }
+}
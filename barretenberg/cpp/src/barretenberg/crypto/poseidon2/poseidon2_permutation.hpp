@@ -160,5 +160,46 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Applies the permutation in place to several independent states in lockstep
+     * @details Each round is applied to every state before moving on to the next round, so the field multiplications
+     * of different states are independent and overlap in the pipeline. This matters most for the internal rounds, which
+     * on a single state form one chain of dependent multiplications through its first element.
+     */
+    template <size_t NUM_LANES> static constexpr void permutation_lanes(std::array<State, NUM_LANES>& states)
+    {
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& state : states) {
+                state[0] += round_constants[i][0];
+                apply_single_sbox(state[0]);
+            }
+            for (auto& state : states) {
+                matrix_multiplication_internal(state);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+    }
 };
 } // namespace bb::crypto
@@ -628,6 +628,16 @@ TEST(fq12, MulSqrConsistency)
     EXPECT_EQ(mul_result, sqr_result);
 }
 
+TEST(fq12, CyclotomicSquaredConsistency)
+{
+    // Map a random element to the cyclotomic subgroup, as the easy part of the final exponentiation does
+    fq12 x = fq12::random_element();
+    fq12 a = x.unitary_inverse() * x.invert();
+    a = a * a.frobenius_map_two();
+    EXPECT_EQ(a.cyclotomic_squared(), a.sqr());
+    EXPECT_EQ(a.cyclotomic_squared().cyclotomic_squared(), a.sqr().sqr());
+}
+
 TEST(fq12, AddMulConsistency)
 {
     fq12 multiplicand = fq12::zero();
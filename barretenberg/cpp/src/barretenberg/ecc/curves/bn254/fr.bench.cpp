@@ -436,5 +436,41 @@ void pow_bench(State& state) noexcept
 }
 BENCHMARK(pow_bench);
 
+void mul_batch_bench(State& state) noexcept
+{
+    const size_t num_elements = static_cast<size_t>(state.range(0));
+    std::vector<fr> lhs(num_elements);
+    std::vector<fr> rhs(num_elements);
+    std::vector<fr> out(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+        lhs[i] = fr::random_element();
+        rhs[i] = fr::random_element();
+    }
+    for (auto _ : state) {
+        fr::mul_batch(lhs, rhs, out);
+        DoNotOptimize(out.data());
+    }
+}
+BENCHMARK(mul_batch_bench)->Arg(1 << 16)->Arg(1 << 20);
+
+void mul_loop_bench(State& state) noexcept
+{
+    const size_t num_elements = static_cast<size_t>(state.range(0));
+    std::vector<fr> lhs(num_elements);
+    std::vector<fr> rhs(num_elements);
+    std::vector<fr> out(num_elements);
+    for (size_t i = 0; i < num_elements; ++i) {
+        lhs[i] = fr::random_element();
+        rhs[i] = fr::random_element();
+    }
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_elements; ++i) {
+            out[i] = lhs[i] * rhs[i];
+        }
+        DoNotOptimize(out.data());
+    }
+}
+BENCHMARK(mul_loop_bench)->Arg(1 << 16)->Arg(1 << 20);
+
 // NOLINTNEXTLINE macro invokation triggers style guideline errors from googletest code
 BENCHMARK_MAIN();
@@ -364,6 +364,46 @@ TEST(fr, BatchInvert)
     }
 }
 
+TEST(fr, BatchArithmeticMatchesScalar)
+{
+    // Odd sizes exercise both the 8-lane kernel (when available) and the scalar tail
+    for (size_t n : { 0UL, 1UL, 7UL, 8UL, 9UL, 67UL }) {
+        std::vector<fr> lhs(n);
+        std::vector<fr> rhs(n);
+        for (size_t i = 0; i < n; ++i) {
+            lhs[i] = fr::random_element();
+            rhs[i] = fr::random_element();
+        }
+        // Inputs in coarse form, i.e. in [p, 2p)
+        for (size_t i = 0; i < n; i += 3) {
+            uint256_t coarse = lhs[i].uint256_t_no_montgomery_conversion() + fr::modulus;
+            lhs[i] = fr{ coarse.data[0], coarse.data[1], coarse.data[2], coarse.data[3] };
+        }
+        const fr scalar = fr::random_element();
+
+        std::vector<fr> products(n);
+        std::vector<fr> scaled(n);
+        std::vector<fr> squares(n);
+        std::vector<fr> sums(n);
+        fr::mul_batch(lhs, rhs, products);
+        fr::mul_batch(lhs, scalar, scaled);
+        fr::sqr_batch(lhs, squares);
+        fr::add_batch(lhs, rhs, sums);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(products[i], lhs[i] * rhs[i]);
+            EXPECT_TRUE(products[i].uint256_t_no_montgomery_conversion() < fr::twice_modulus);
+            EXPECT_EQ(scaled[i], lhs[i] * scalar);
+            EXPECT_EQ(squares[i], lhs[i].sqr());
+            EXPECT_EQ(sums[i], lhs[i] + rhs[i]);
+        }
+
+        // in-place
+        std::vector<fr> in_place = lhs;
+        fr::mul_batch(in_place, rhs, in_place);
+        EXPECT_EQ(in_place, products);
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
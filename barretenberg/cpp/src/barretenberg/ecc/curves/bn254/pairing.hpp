@@ -12,6 +12,8 @@ namespace bb::pairing {
 constexpr size_t loop_length = 64;
 constexpr size_t neg_z_loop_length = 62;
 constexpr size_t precomputed_coefficients_length = 87;
+// Splitting the Miller loop across threads costs an extra fq12 multiplication and 64 squarings per thread
+constexpr size_t min_pairs_per_miller_loop_thread = 2;
 
 constexpr std::array<uint8_t, loop_length> loop_bits{ 1, 0, 1, 0, 0, 0, 3, 0, 3, 0, 0, 0, 3, 0, 1, 0, 3, 0, 0, 3, 0, 0,
                                                       0, 0, 0, 1, 0, 0, 3, 0, 1, 0, 0, 3, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0,
@@ -40,6 +42,8 @@ constexpr fq12 miller_loop(const g1::element& P, const miller_lines& lines);
 
 constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines* lines, size_t num_pairs);
 
+inline fq12 miller_loop_batch_parallel(const g1::element* points, const miller_lines* lines, size_t num_pairs);
+
 constexpr void final_exponentiation_easy_part(const fq12& elt, fq12& r);
 
 constexpr void final_exponentiation_exp_by_neg_z(const fq12& elt, fq12& r);
@@ -3,6 +3,7 @@
 #include "./fq12.hpp"
 #include "./g1.hpp"
 #include "./g2.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 
 namespace bb::pairing {
@@ -202,6 +203,32 @@ constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines*
     return work_scalar;
 }
 
+/**
+ * @brief miller_loop_batch with the pairs split across threads
+ * @details The Miller loop of a product of pairings is the product of the Miller loops of its factors, so each thread
+ * runs the batched Miller loop over a range of pairs and the partial results are multiplied together. A single final
+ * exponentiation of the product is then enough for the whole batch.
+ */
+fq12 miller_loop_batch_parallel(const g1::element* points, const miller_lines* lines, const size_t num_pairs)
+{
+    const size_t num_threads = std::max(
+        static_cast<size_t>(1), std::min(get_num_cpus(), num_pairs / min_pairs_per_miller_loop_thread));
+    if (num_threads == 1) {
+        return miller_loop_batch(points, lines, num_pairs);
+    }
+    std::vector<fq12> partial_results(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * num_pairs / num_threads;
+        const size_t end = (thread_idx + 1) * num_pairs / num_threads;
+        partial_results[thread_idx] = miller_loop_batch(points + start, lines + start, end - start);
+    });
+    fq12 result = partial_results[0];
+    for (size_t i = 1; i < num_threads; ++i) {
+        result *= partial_results[i];
+    }
+    return result;
+}
+
 constexpr fq12 final_exponentiation_easy_part(const fq12& elt)
 {
     fq12 a{ elt.c0, -elt.c1 };
@@ -271,7 +298,7 @@ fq12 reduced_ate_pairing_batch_precomputed(const g1::affine_element* P_affines,
     for (size_t i = 0; i < num_points; ++i) {
         P[i] = g1::element(P_affines[i]);
     }
-    fq12 result = miller_loop_batch(&P[0], &lines[0], num_points);
+    fq12 result = miller_loop_batch_parallel(&P[0], &lines[0], num_points);
     result = final_exponentiation_easy_part(result);
     result = final_exponentiation_tricky_part(result);
     return result;
@@ -285,14 +312,14 @@ fq12 reduced_ate_pairing_batch(const g1::affine_element* P_affines,
     std::vector<g2::element> Q(num_points);
     std::vector<miller_lines> lines(num_points);
 
-    for (size_t i = 0; i < num_points; ++i) {
+    parallel_for(num_points, [&](size_t i) {
         P[i] = g1::element(P_affines[i]);
         Q[i] = g2::element(Q_affines[i]);
 
         precompute_miller_lines(Q[i], lines[i]);
-    }
+    });
 
-    fq12 result = miller_loop_batch(&P[0], &lines[0], num_points);
+    fq12 result = miller_loop_batch_parallel(&P[0], &lines[0], num_points);
     result = final_exponentiation_easy_part(result);
     result = final_exponentiation_tricky_part(result);
     return result;
@@ -223,11 +223,48 @@ template <typename quadratic_field, typename base_field, typename Fq12Params> cl
         };
     }
 
+    /**
+     * @brief Squaring of an element of the cyclotomic subgroup, i.e. one with x^(p^6 + 1) = 1
+     * @details Granger-Scott squaring (https://eprint.iacr.org/2009/565.pdf, section 3.2). Writing the element as
+     * (z0 + z1⋅s) + (z2 + z3⋅s)⋅t + (z4 + z5⋅s)⋅t² over the tower Fq4 = Fq2[s]/(s² - ξ), Fq12 = Fq4[t]/(t³ - s), the
+     * square only needs the squares of the three Fq4 coefficients, i.e. 9 Fq2 squarings instead of the 12 Fq2
+     * multiplications of the generic squaring. The result is only correct in the cyclotomic subgroup, which is where
+     * the elements of the hard part of the final exponentiation live.
+     */
     constexpr field12 cyclotomic_squared() const
     {
-        // Possible Optimization: The cyclotomic squaring can be implemented more than efficiently
-        // than the generic squaring.
-        return sqr();
+        const quadratic_field& z0 = c0.c0;
+        const quadratic_field& z4 = c0.c1;
+        const quadratic_field& z3 = c0.c2;
+        const quadratic_field& z2 = c1.c0;
+        const quadratic_field& z1 = c1.c1;
+        const quadratic_field& z5 = c1.c2;
+
+        // (a + b⋅s)² = (a² + ξ⋅b²) + 2ab⋅s
+        const auto fq4_square = [](const quadratic_field& a, const quadratic_field& b) {
+            const quadratic_field a_sqr = a.sqr();
+            const quadratic_field b_sqr = b.sqr();
+            const quadratic_field two_ab = (a + b).sqr() - (a_sqr + b_sqr);
+            return std::pair{ a_sqr + base_field::mul_by_non_residue(b_sqr), two_ab };
+        };
+        const auto [t0, t1] = fq4_square(z0, z1);
+        const auto [t2, t3] = fq4_square(z2, z3);
+        const auto [t4, t5] = fq4_square(z4, z5);
+
+        // 3t - 2z and 3t + 2z
+        const auto minus = [](const quadratic_field& t, const quadratic_field& z) {
+            quadratic_field r = t - z;
+            return r + r + t;
+        };
+        const auto plus = [](const quadratic_field& t, const quadratic_field& z) {
+            quadratic_field r = t + z;
+            return r + r + t;
+        };
+
+        return {
+            { minus(t0, z0), minus(t2, z4), minus(t4, z3) },
+            { plus(base_field::mul_by_non_residue(t5), z2), plus(t1, z1), plus(t3, z5) },
+        };
     }
 
     constexpr field12 unitary_inverse() const
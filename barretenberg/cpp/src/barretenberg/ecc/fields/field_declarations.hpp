@@ -325,6 +325,16 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+
+    /**
+     * @brief Element-wise arithmetic over spans, dispatching to an 8-lane AVX-512 IFMA kernel at runtime when the CPU
+     * supports it (254-bit moduli only). `out` may alias an input; results are in the same (coarse) form as the
+     * scalar operators.
+     */
+    static void mul_batch(std::span<const field> lhs, std::span<const field> rhs, std::span<field> out) noexcept;
+    static void mul_batch(std::span<const field> lhs, const field& scalar, std::span<field> out) noexcept;
+    static void sqr_batch(std::span<const field> in, std::span<field> out) noexcept;
+    static void add_batch(std::span<const field> lhs, std::span<const field> rhs, std::span<field> out) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "./field_declarations.hpp"
+#include "./field_impl_ifma.hpp"
 
 namespace bb {
 
@@ -452,6 +453,85 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+template <class T>
+void field<T>::mul_batch(std::span<const field> lhs, std::span<const field> rhs, std::span<field> out) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::mul_batch");
+    ASSERT(lhs.size() == rhs.size() && out.size() >= lhs.size());
+    const size_t n = lhs.size();
+    size_t i = 0;
+#if BB_HAS_IFMA_KERNELS
+    // The kernel relies on the coarse-form bound a, b < 2p < 2^255
+    if constexpr (T::modulus_3 < 0x4000000000000000ULL && T::modulus_3 != 0) {
+        if (ifma::is_supported()) {
+            i = ifma::mul_batch<T>(reinterpret_cast<const uint64_t*>(lhs.data()),
+                                   reinterpret_cast<const uint64_t*>(rhs.data()),
+                                   reinterpret_cast<uint64_t*>(out.data()),
+                                   n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = lhs[i] * rhs[i];
+    }
+}
+
+template <class T>
+void field<T>::mul_batch(std::span<const field> lhs, const field& scalar, std::span<field> out) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::mul_batch");
+    ASSERT(out.size() >= lhs.size());
+    const size_t n = lhs.size();
+    size_t i = 0;
+#if BB_HAS_IFMA_KERNELS
+    if constexpr (T::modulus_3 < 0x4000000000000000ULL && T::modulus_3 != 0) {
+        if (ifma::is_supported()) {
+            i = ifma::mul_batch_by_scalar<T>(reinterpret_cast<const uint64_t*>(lhs.data()),
+                                             &scalar.data[0],
+                                             reinterpret_cast<uint64_t*>(out.data()),
+                                             n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = lhs[i] * scalar;
+    }
+}
+
+template <class T> void field<T>::sqr_batch(std::span<const field> in, std::span<field> out) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::sqr_batch");
+    ASSERT(out.size() >= in.size());
+    const size_t n = in.size();
+    size_t i = 0;
+#if BB_HAS_IFMA_KERNELS
+    if constexpr (T::modulus_3 < 0x4000000000000000ULL && T::modulus_3 != 0) {
+        if (ifma::is_supported()) {
+            i = ifma::sqr_batch<T>(
+                reinterpret_cast<const uint64_t*>(in.data()), reinterpret_cast<uint64_t*>(out.data()), n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = in[i].sqr();
+    }
+}
+
+/**
+ * @brief Element-wise addition. Additions are memory-bound and the 4x64 add-with-carry chain does not map onto SIMD
+ * lanes without a limb conversion, so this stays on the scalar (ADX) path; it exists so that callers can express whole
+ * loops in terms of the batch API.
+ */
+template <class T>
+void field<T>::add_batch(std::span<const field> lhs, std::span<const field> rhs, std::span<field> out) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::add_batch");
+    ASSERT(lhs.size() == rhs.size() && out.size() >= lhs.size());
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        out[i] = lhs[i] + rhs[i];
+    }
+}
+
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
 {
     BB_OP_COUNT_TRACK_NAME("fr::tonelli_shanks_sqrt");
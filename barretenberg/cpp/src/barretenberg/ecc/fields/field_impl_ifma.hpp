@@ -0,0 +1,335 @@
+#pragma once
+
+/**
+ * @brief 8-lane Montgomery multiplication over 52-bit limbs using AVX-512 IFMA (vpmadd52luq / vpmadd52huq).
+ *
+ * @details Each 512-bit register holds the same limb of 8 different field elements, so one pass of the kernel
+ * multiplies 8 pairs of elements. Elements are converted from the usual 4x64-bit representation into 5x52-bit limbs,
+ * i.e. the kernel works with a Montgomery radix of R' = 2^260 instead of R = 2^256. To keep results in the standard
+ * (R = 2^256) Montgomery domain the right-hand operand is shifted left by 4 bits during conversion, which gives
+ *
+ *      (a * 16b) / 2^260 = (a * b) / 2^256 mod p.
+ *
+ * For a, b in the coarse range [0, 2p) with p < 2^254 the output is
+ *
+ *      (a * 16b + M * p) / 2^260 < (64 p^2) / 2^260 + p < 2p,   (M < 2^260)
+ *
+ * so the kernel produces coarse-form elements, exactly like `asm_mul_with_coarse_reduction`. Limb accumulators are
+ * not normalized between iterations: every accumulator receives at most 4 terms < 2^52 per iteration, which leaves
+ * plenty of headroom in the 64-bit lanes over the 5 iterations.
+ *
+ * The kernels are compiled with a function-level target attribute so that the rest of the library does not require
+ * AVX-512 at build time. Callers must check `ifma::is_supported()` before dispatching to them.
+ */
+#if !defined(__wasm__) && defined(__x86_64__) && (BBERG_NO_ASM == 0)
+#define BB_HAS_IFMA_KERNELS 1
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+// GCC reports false positives on the `_mm512_undefined_epi32()` pass-through operand used by its intrinsic wrappers
+#if !defined(__clang__) && defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace bb::ifma {
+
+#define BB_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+static constexpr size_t LANES = 8;
+static constexpr uint64_t LIMB_MASK = (1ULL << 52) - 1;
+
+/**
+ * @brief Runtime check for AVX-512F + AVX-512 IFMA. Evaluated once per process.
+ */
+inline bool is_supported()
+{
+    static const bool supported = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f") != 0 && __builtin_cpu_supports("avx512ifma") != 0;
+    }();
+    return supported;
+}
+
+/**
+ * @brief Modulus of the field in 5x52-bit limbs plus -p^{-1} mod 2^52
+ */
+template <class Params> struct Constants {
+    static constexpr uint64_t p0 = Params::modulus_0 & LIMB_MASK;
+    static constexpr uint64_t p1 = ((Params::modulus_0 >> 52) | (Params::modulus_1 << 12)) & LIMB_MASK;
+    static constexpr uint64_t p2 = ((Params::modulus_1 >> 40) | (Params::modulus_2 << 24)) & LIMB_MASK;
+    static constexpr uint64_t p3 = ((Params::modulus_2 >> 28) | (Params::modulus_3 << 36)) & LIMB_MASK;
+    static constexpr uint64_t p4 = Params::modulus_3 >> 16;
+    // r_inv = -p^{-1} mod 2^64, so its low 52 bits are -p^{-1} mod 2^52
+    static constexpr uint64_t r_inv = Params::r_inv & LIMB_MASK;
+};
+
+struct Limbs {
+    __m512i l0;
+    __m512i l1;
+    __m512i l2;
+    __m512i l3;
+    __m512i l4;
+};
+
+/**
+ * @brief Load 8 consecutive field elements (4x64 limbs each) and transpose them into 4 registers, one per 64-bit limb
+ */
+BB_IFMA_TARGET inline void load_transposed(
+    const uint64_t* src, __m512i& d0, __m512i& d1, __m512i& d2, __m512i& d3) noexcept
+{
+    const __m512i v0 = _mm512_loadu_si512(src);
+    const __m512i v1 = _mm512_loadu_si512(src + 8);
+    const __m512i v2 = _mm512_loadu_si512(src + 16);
+    const __m512i v3 = _mm512_loadu_si512(src + 24);
+
+    const __m512i idx_lo = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i idx_hi = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    // [e0.d0, e1.d0, e2.d0, e3.d0, e0.d1, e1.d1, e2.d1, e3.d1] etc.
+    const __m512i t01_lo = _mm512_permutex2var_epi64(v0, idx_lo, v1);
+    const __m512i t01_hi = _mm512_permutex2var_epi64(v0, idx_hi, v1);
+    const __m512i t23_lo = _mm512_permutex2var_epi64(v2, idx_lo, v3);
+    const __m512i t23_hi = _mm512_permutex2var_epi64(v2, idx_hi, v3);
+
+    const __m512i first_half = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i second_half = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    d0 = _mm512_permutex2var_epi64(t01_lo, first_half, t23_lo);
+    d1 = _mm512_permutex2var_epi64(t01_lo, second_half, t23_lo);
+    d2 = _mm512_permutex2var_epi64(t01_hi, first_half, t23_hi);
+    d3 = _mm512_permutex2var_epi64(t01_hi, second_half, t23_hi);
+}
+
+/**
+ * @brief Inverse of `load_transposed`
+ */
+BB_IFMA_TARGET inline void store_transposed(
+    uint64_t* dst, const __m512i d0, const __m512i d1, const __m512i d2, const __m512i d3) noexcept
+{
+    const __m512i idx_lo = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+    const __m512i idx_hi = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+    // [e0.d0, e0.d1, e1.d0, e1.d1, e2.d0, e2.d1, e3.d0, e3.d1] etc.
+    const __m512i d01_lo = _mm512_permutex2var_epi64(d0, idx_lo, d1);
+    const __m512i d01_hi = _mm512_permutex2var_epi64(d0, idx_hi, d1);
+    const __m512i d23_lo = _mm512_permutex2var_epi64(d2, idx_lo, d3);
+    const __m512i d23_hi = _mm512_permutex2var_epi64(d2, idx_hi, d3);
+
+    const __m512i first_pair = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+    const __m512i second_pair = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+    _mm512_storeu_si512(dst, _mm512_permutex2var_epi64(d01_lo, first_pair, d23_lo));
+    _mm512_storeu_si512(dst + 8, _mm512_permutex2var_epi64(d01_lo, second_pair, d23_lo));
+    _mm512_storeu_si512(dst + 16, _mm512_permutex2var_epi64(d01_hi, first_pair, d23_hi));
+    _mm512_storeu_si512(dst + 24, _mm512_permutex2var_epi64(d01_hi, second_pair, d23_hi));
+}
+
+/**
+ * @brief Split 4x64-bit limbs into 5x52-bit limbs
+ */
+BB_IFMA_TARGET inline Limbs to_radix_52(const __m512i d0,
+                                        const __m512i d1,
+                                        const __m512i d2,
+                                        const __m512i d3) noexcept
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    return {
+        _mm512_and_si512(d0, mask),
+        _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d0, 52), _mm512_slli_epi64(d1, 12)), mask),
+        _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d1, 40), _mm512_slli_epi64(d2, 24)), mask),
+        _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d2, 28), _mm512_slli_epi64(d3, 36)), mask),
+        _mm512_srli_epi64(d3, 16),
+    };
+}
+
+/**
+ * @brief Split 4x64-bit limbs of (16 * x) into 5x52-bit limbs. Requires x < 2^256 (always true).
+ */
+BB_IFMA_TARGET inline Limbs to_radix_52_shifted(const __m512i d0,
+                                                const __m512i d1,
+                                                const __m512i d2,
+                                                const __m512i d3) noexcept
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    return {
+        _mm512_and_si512(_mm512_slli_epi64(d0, 4), mask),
+        _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d0, 48), _mm512_slli_epi64(d1, 16)), mask),
+        _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d1, 36), _mm512_slli_epi64(d2, 28)), mask),
+        _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d2, 24), _mm512_slli_epi64(d3, 40)), mask),
+        _mm512_srli_epi64(d3, 12),
+    };
+}
+
+/**
+ * @brief Normalize the 52-bit limb accumulators and recombine them into 4x64-bit limbs
+ */
+BB_IFMA_TARGET inline void from_radix_52(__m512i l0,
+                                         __m512i l1,
+                                         __m512i l2,
+                                         __m512i l3,
+                                         __m512i l4,
+                                         __m512i& d0,
+                                         __m512i& d1,
+                                         __m512i& d2,
+                                         __m512i& d3) noexcept
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    l1 = _mm512_add_epi64(l1, _mm512_srli_epi64(l0, 52));
+    l0 = _mm512_and_si512(l0, mask);
+    l2 = _mm512_add_epi64(l2, _mm512_srli_epi64(l1, 52));
+    l1 = _mm512_and_si512(l1, mask);
+    l3 = _mm512_add_epi64(l3, _mm512_srli_epi64(l2, 52));
+    l2 = _mm512_and_si512(l2, mask);
+    l4 = _mm512_add_epi64(l4, _mm512_srli_epi64(l3, 52));
+    l3 = _mm512_and_si512(l3, mask);
+
+    d0 = _mm512_or_si512(l0, _mm512_slli_epi64(l1, 52));
+    d1 = _mm512_or_si512(_mm512_srli_epi64(l1, 12), _mm512_slli_epi64(l2, 40));
+    d2 = _mm512_or_si512(_mm512_srli_epi64(l2, 24), _mm512_slli_epi64(l3, 28));
+    d3 = _mm512_or_si512(_mm512_srli_epi64(l3, 36), _mm512_slli_epi64(l4, 16));
+}
+
+/**
+ * @brief Montgomery multiplication of 8 lanes, a * b / 2^260 mod p. See file comment for the bounds.
+ */
+template <class Params>
+BB_IFMA_TARGET inline void montgomery_mul(
+    const Limbs& a, const Limbs& b, __m512i& d0, __m512i& d1, __m512i& d2, __m512i& d3) noexcept
+{
+    using C = Constants<Params>;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i p0 = _mm512_set1_epi64(static_cast<int64_t>(C::p0));
+    const __m512i p1 = _mm512_set1_epi64(static_cast<int64_t>(C::p1));
+    const __m512i p2 = _mm512_set1_epi64(static_cast<int64_t>(C::p2));
+    const __m512i p3 = _mm512_set1_epi64(static_cast<int64_t>(C::p3));
+    const __m512i p4 = _mm512_set1_epi64(static_cast<int64_t>(C::p4));
+    const __m512i r_inv = _mm512_set1_epi64(static_cast<int64_t>(C::r_inv));
+
+    __m512i t0 = zero;
+    __m512i t1 = zero;
+    __m512i t2 = zero;
+    __m512i t3 = zero;
+    __m512i t4 = zero;
+    __m512i t5 = zero;
+
+    const __m512i b_limbs[5] = { b.l0, b.l1, b.l2, b.l3, b.l4 }; // NOLINT
+    for (const __m512i& bi : b_limbs) {
+        t0 = _mm512_madd52lo_epu64(t0, a.l0, bi);
+        t1 = _mm512_madd52lo_epu64(t1, a.l1, bi);
+        t2 = _mm512_madd52lo_epu64(t2, a.l2, bi);
+        t3 = _mm512_madd52lo_epu64(t3, a.l3, bi);
+        t4 = _mm512_madd52lo_epu64(t4, a.l4, bi);
+        t1 = _mm512_madd52hi_epu64(t1, a.l0, bi);
+        t2 = _mm512_madd52hi_epu64(t2, a.l1, bi);
+        t3 = _mm512_madd52hi_epu64(t3, a.l2, bi);
+        t4 = _mm512_madd52hi_epu64(t4, a.l3, bi);
+        t5 = _mm512_madd52hi_epu64(t5, a.l4, bi);
+
+        // m = t0 * (-p^{-1}) mod 2^52. Only the low 52 bits of t0 are consumed by the multiplier.
+        const __m512i m = _mm512_madd52lo_epu64(zero, t0, r_inv);
+
+        t0 = _mm512_madd52lo_epu64(t0, m, p0);
+        t1 = _mm512_madd52lo_epu64(t1, m, p1);
+        t2 = _mm512_madd52lo_epu64(t2, m, p2);
+        t3 = _mm512_madd52lo_epu64(t3, m, p3);
+        t4 = _mm512_madd52lo_epu64(t4, m, p4);
+        t1 = _mm512_madd52hi_epu64(t1, m, p0);
+        t2 = _mm512_madd52hi_epu64(t2, m, p1);
+        t3 = _mm512_madd52hi_epu64(t3, m, p2);
+        t4 = _mm512_madd52hi_epu64(t4, m, p3);
+        t5 = _mm512_madd52hi_epu64(t5, m, p4);
+
+        // the low 52 bits of t0 are now zero: shift the accumulator down by one limb, keeping the carry
+        t0 = _mm512_add_epi64(t1, _mm512_srli_epi64(t0, 52));
+        t1 = t2;
+        t2 = t3;
+        t3 = t4;
+        t4 = t5;
+        t5 = zero;
+    }
+    from_radix_52(t0, t1, t2, t3, t4, d0, d1, d2, d3);
+}
+
+/**
+ * @brief out[i] = lhs[i] * rhs[i] for the largest multiple of 8 elements not exceeding n.
+ * @details Pointers refer to arrays of field elements viewed as 4 little-endian uint64_t limbs. `out` may alias either
+ * input.
+ * @return Number of elements processed
+ */
+template <class Params>
+BB_IFMA_TARGET size_t mul_batch(const uint64_t* lhs, const uint64_t* rhs, uint64_t* out, const size_t n) noexcept
+{
+    const size_t num_full = n - (n % LANES);
+    for (size_t i = 0; i < num_full; i += LANES) {
+        __m512i d0;
+        __m512i d1;
+        __m512i d2;
+        __m512i d3;
+        load_transposed(lhs + 4 * i, d0, d1, d2, d3);
+        const Limbs a = to_radix_52(d0, d1, d2, d3);
+        load_transposed(rhs + 4 * i, d0, d1, d2, d3);
+        const Limbs b = to_radix_52_shifted(d0, d1, d2, d3);
+        montgomery_mul<Params>(a, b, d0, d1, d2, d3);
+        store_transposed(out + 4 * i, d0, d1, d2, d3);
+    }
+    return num_full;
+}
+
+/**
+ * @brief out[i] = lhs[i] * scalar. The scalar is converted once and broadcast across lanes.
+ * @return Number of elements processed
+ */
+template <class Params>
+BB_IFMA_TARGET size_t mul_batch_by_scalar(const uint64_t* lhs,
+                                          const uint64_t* scalar,
+                                          uint64_t* out,
+                                          const size_t n) noexcept
+{
+    const Limbs b = to_radix_52_shifted(_mm512_set1_epi64(static_cast<int64_t>(scalar[0])),
+                                        _mm512_set1_epi64(static_cast<int64_t>(scalar[1])),
+                                        _mm512_set1_epi64(static_cast<int64_t>(scalar[2])),
+                                        _mm512_set1_epi64(static_cast<int64_t>(scalar[3])));
+    const size_t num_full = n - (n % LANES);
+    for (size_t i = 0; i < num_full; i += LANES) {
+        __m512i d0;
+        __m512i d1;
+        __m512i d2;
+        __m512i d3;
+        load_transposed(lhs + 4 * i, d0, d1, d2, d3);
+        const Limbs a = to_radix_52(d0, d1, d2, d3);
+        montgomery_mul<Params>(a, b, d0, d1, d2, d3);
+        store_transposed(out + 4 * i, d0, d1, d2, d3);
+    }
+    return num_full;
+}
+
+/**
+ * @brief out[i] = in[i]^2
+ * @return Number of elements processed
+ */
+template <class Params> BB_IFMA_TARGET size_t sqr_batch(const uint64_t* in, uint64_t* out, const size_t n) noexcept
+{
+    const size_t num_full = n - (n % LANES);
+    for (size_t i = 0; i < num_full; i += LANES) {
+        __m512i d0;
+        __m512i d1;
+        __m512i d2;
+        __m512i d3;
+        load_transposed(in + 4 * i, d0, d1, d2, d3);
+        const Limbs a = to_radix_52(d0, d1, d2, d3);
+        const Limbs b = to_radix_52_shifted(d0, d1, d2, d3);
+        montgomery_mul<Params>(a, b, d0, d1, d2, d3);
+        store_transposed(out + 4 * i, d0, d1, d2, d3);
+    }
+    return num_full;
+}
+
+#undef BB_IFMA_TARGET
+
+} // namespace bb::ifma
+
+#if !defined(__clang__) && defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+#else
+#define BB_HAS_IFMA_KERNELS 0
+#endif
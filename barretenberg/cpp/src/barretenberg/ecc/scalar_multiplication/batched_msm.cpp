@@ -0,0 +1,285 @@
+#include "batched_msm.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/process_buckets.hpp"
+#include "barretenberg/ecc/scalar_multiplication/runtime_states.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digits.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <numeric>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+
+// Number of scalars per unit of work when splitting scalars with the endomorphism
+constexpr size_t SCALAR_CHUNK_SIZE = 1UL << 12;
+// Upper bound on the number of split scalars held in memory at once; MSMs are processed in groups below this bound
+constexpr size_t MAX_GROUP_SCALARS = 1UL << 21;
+// construct_addition_chains reads ahead of the current point schedule entry
+constexpr size_t SCHEDULE_PREFETCH_OVERFLOW = 16;
+// Bucket indices occupy the low 31 bits of a schedule entry, the sign bit 31 and the point index the high 32 bits
+constexpr uint64_t SCHEDULE_BUCKET_MASK = 0x7fffffffULL;
+constexpr uint64_t SCHEDULE_NEGATE_BIT = 31;
+
+struct ScalarChunk {
+    size_t msm_idx;
+    size_t start;
+    size_t end;
+};
+
+// Layout of the nonzero split scalars of one MSM within the group buffers
+struct MsmInfo {
+    size_t offset = 0;
+    size_t num_nonzero = 0;
+    size_t window_bits = 0;
+    size_t num_windows = 0;
+};
+
+/**
+ * @brief Per-thread buffers for evaluating rounds, reused across rounds to avoid reallocating (and zeroing) them
+ */
+template <typename Curve> struct RoundWorkspace {
+    std::vector<uint64_t> schedule;
+    std::vector<typename Curve::AffineElement> point_pairs_1;
+    std::vector<typename Curve::AffineElement> point_pairs_2;
+    std::vector<typename Curve::BaseField> scratch_space;
+    std::vector<uint32_t> bucket_counts;
+    std::unique_ptr<bool[]> bucket_empty_status;
+    size_t bucket_capacity = 0;
+
+    void reserve(size_t num_entries, size_t num_buckets)
+    {
+        if (schedule.size() < num_entries + SCHEDULE_PREFETCH_OVERFLOW) {
+            schedule.resize(num_entries + SCHEDULE_PREFETCH_OVERFLOW);
+            point_pairs_1.resize(num_entries + SCHEDULE_PREFETCH_OVERFLOW);
+            point_pairs_2.resize(num_entries + SCHEDULE_PREFETCH_OVERFLOW);
+            scratch_space.resize(num_entries);
+        }
+        if (bucket_capacity < num_buckets) {
+            bucket_counts.resize(num_buckets);
+            bucket_empty_status = std::make_unique<bool[]>(num_buckets);
+            bucket_capacity = num_buckets;
+        }
+    }
+};
+
+/**
+ * @brief Sum the scheduled points of one pippenger round into \sum_b (b + 1) * B_b
+ */
+template <typename Curve>
+typename Curve::Element evaluate_round(std::span<const typename Curve::AffineElement> point_table,
+                                       RoundWorkspace<Curve>& workspace,
+                                       size_t num_entries,
+                                       size_t window_bits)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    Element accumulator = Element::infinity();
+    if (num_entries == 0) {
+        return accumulator;
+    }
+    uint64_t* schedule = workspace.schedule.data();
+    process_buckets(schedule, num_entries, static_cast<uint32_t>(window_bits - 1));
+    // reduce_buckets works relative to the first occupied bucket and overwrites the schedule
+    const auto first_bucket = static_cast<uint32_t>(schedule[0] & SCHEDULE_BUCKET_MASK);
+    const auto last_bucket = static_cast<uint32_t>(schedule[num_entries - 1] & SCHEDULE_BUCKET_MASK);
+    const uint32_t num_buckets = last_bucket - first_bucket + 1;
+    // construct_addition_chains reads ahead of the last entry
+    std::fill_n(schedule + num_entries, SCHEDULE_PREFETCH_OVERFLOW, 0);
+
+    std::array<uint32_t, 32> bit_offsets{};
+    affine_product_runtime_state<Curve> state{ .points = point_table.data(),
+                                               .point_pairs_1 = workspace.point_pairs_1.data(),
+                                               .point_pairs_2 = workspace.point_pairs_2.data(),
+                                               .scratch_space = workspace.scratch_space.data(),
+                                               .bucket_counts = workspace.bucket_counts.data(),
+                                               .bit_offsets = bit_offsets.data(),
+                                               .point_schedule = schedule,
+                                               .num_points = static_cast<uint32_t>(num_entries),
+                                               .num_buckets = num_buckets,
+                                               .bucket_empty_status = workspace.bucket_empty_status.get() };
+    const AffineElement* bucket_sums = reduce_buckets(state, true, false);
+
+    // The reduced buckets are stored in increasing bucket order, one per occupied bucket
+    Element running_sum = Element::infinity();
+    size_t sum_idx = state.num_points;
+    for (size_t bucket = num_buckets; bucket > 0; --bucket) {
+        if (!workspace.bucket_empty_status[bucket - 1]) {
+            running_sum += bucket_sums[--sum_idx];
+        }
+        accumulator += running_sum;
+    }
+    if (first_bucket > 0) {
+        accumulator += running_sum * Fr(first_bucket);
+    }
+    return accumulator;
+}
+
+} // namespace
+
+template <typename Curve>
+std::vector<typename Curve::AffineElement> batch_msm_unsafe(
+    std::span<const typename Curve::AffineElement> point_table,
+    std::span<const PolynomialSpan<const typename Curve::ScalarField>> scalars)
+{
+    PROFILE_THIS();
+
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_msms = scalars.size();
+
+    // Count the nonzero scalars of each chunk of each MSM
+    std::vector<ScalarChunk> chunks;
+    for (size_t msm_idx = 0; msm_idx < num_msms; ++msm_idx) {
+        ASSERT(2 * scalars[msm_idx].end_index() <= point_table.size());
+        for (size_t start = 0; start < scalars[msm_idx].size(); start += SCALAR_CHUNK_SIZE) {
+            chunks.push_back({ msm_idx, start, std::min(start + SCALAR_CHUNK_SIZE, scalars[msm_idx].size()) });
+        }
+    }
+    std::vector<size_t> chunk_offsets(chunks.size());
+    parallel_for(chunks.size(), [&](size_t chunk_idx) {
+        const auto& chunk = chunks[chunk_idx];
+        const auto& span = scalars[chunk.msm_idx].span;
+        chunk_offsets[chunk_idx] = static_cast<size_t>(
+            std::count_if(span.begin() + static_cast<std::ptrdiff_t>(chunk.start),
+                          span.begin() + static_cast<std::ptrdiff_t>(chunk.end),
+                          [](const Fr& scalar) { return !scalar.is_zero(); }));
+    });
+
+    // Turn the chunk counts into offsets within their MSM and choose each MSM's window size as pippenger would
+    std::vector<MsmInfo> msm_infos(num_msms);
+    for (size_t chunk_idx = 0; chunk_idx < chunks.size(); ++chunk_idx) {
+        auto& info = msm_infos[chunks[chunk_idx].msm_idx];
+        const size_t count = chunk_offsets[chunk_idx];
+        chunk_offsets[chunk_idx] = info.num_nonzero;
+        info.num_nonzero += count;
+    }
+    for (auto& info : msm_infos) {
+        ASSERT(info.num_nonzero <= BATCH_MSM_MAX_NONZERO_SCALARS);
+        info.window_bits = get_optimal_bucket_width(info.num_nonzero) + 1;
+        // An MSM without nonzero scalars needs no rounds at all
+        info.num_windows = info.num_nonzero > 0 ? (128 + info.window_bits) / info.window_bits : 0;
+    }
+
+    std::vector<AffineElement> results(num_msms);
+    std::vector<uint32_t> point_indices;
+    std::vector<std::array<uint64_t, 4>> split_scalars;
+    size_t chunk_begin = 0;
+    size_t msm_begin = 0;
+    while (msm_begin < num_msms) {
+        // Take as many MSMs as fit within the group bound, and always at least one
+        size_t msm_end = msm_begin;
+        size_t group_size = 0;
+        while (msm_end < num_msms &&
+               (msm_end == msm_begin || group_size + msm_infos[msm_end].num_nonzero <= MAX_GROUP_SCALARS)) {
+            msm_infos[msm_end].offset = group_size;
+            group_size += msm_infos[msm_end].num_nonzero;
+            ++msm_end;
+        }
+        size_t chunk_end = chunk_begin;
+        while (chunk_end < chunks.size() && chunks[chunk_end].msm_idx < msm_end) {
+            ++chunk_end;
+        }
+
+        // Split the nonzero scalars of the group with the endomorphism
+        point_indices.resize(group_size);
+        split_scalars.resize(group_size);
+        parallel_for(chunk_end - chunk_begin, [&](size_t i) {
+            const auto& chunk = chunks[chunk_begin + i];
+            const auto& msm_scalars = scalars[chunk.msm_idx];
+            size_t out = msm_infos[chunk.msm_idx].offset + chunk_offsets[chunk_begin + i];
+            for (size_t j = chunk.start; j < chunk.end; ++j) {
+                if (msm_scalars.span[j].is_zero()) {
+                    continue;
+                }
+                Fr k = msm_scalars.span[j].from_montgomery_form();
+                Fr::split_into_endomorphism_scalars(k, k, *reinterpret_cast<Fr*>(&k.data[2]));
+                std::copy(std::begin(k.data), std::end(k.data), split_scalars[out].begin());
+                point_indices[out] = static_cast<uint32_t>(msm_scalars.start_index + j);
+                ++out;
+            }
+        });
+
+        // Evaluate the rounds of all MSMs of the group together. Threads pull rounds off a shared counter, largest
+        // first, so that rounds of differently sized MSMs balance out.
+        std::vector<std::pair<size_t, size_t>> rounds;
+        std::vector<size_t> round_offsets(msm_end - msm_begin);
+        for (size_t msm_idx = msm_begin; msm_idx < msm_end; ++msm_idx) {
+            round_offsets[msm_idx - msm_begin] = rounds.size();
+            for (size_t window = 0; window < msm_infos[msm_idx].num_windows; ++window) {
+                rounds.emplace_back(msm_idx, window);
+            }
+        }
+        std::vector<size_t> round_order(rounds.size());
+        std::iota(round_order.begin(), round_order.end(), 0);
+        std::stable_sort(round_order.begin(), round_order.end(), [&](size_t a, size_t b) {
+            return msm_infos[rounds[a].first].num_nonzero > msm_infos[rounds[b].first].num_nonzero;
+        });
+        std::vector<Element> round_sums(rounds.size());
+        std::atomic<size_t> next_round = 0;
+        parallel_for(std::min(get_num_cpus(), rounds.size()), [&](size_t) {
+            RoundWorkspace<Curve> workspace;
+            for (size_t order_idx = next_round++; order_idx < rounds.size(); order_idx = next_round++) {
+                const size_t round_idx = round_order[order_idx];
+                const auto [msm_idx, window] = rounds[round_idx];
+                const auto& info = msm_infos[msm_idx];
+                const SignedDigits digits(info.window_bits, info.num_windows);
+                workspace.reserve(2 * info.num_nonzero, 1UL << (info.window_bits - 1));
+                size_t num_entries = 0;
+                for (size_t i = info.offset; i < info.offset + info.num_nonzero; ++i) {
+                    for (size_t half = 0; half < 2; ++half) {
+                        bool is_negative = false;
+                        const uint64_t magnitude = digits.get(&split_scalars[i][2 * half], window, is_negative);
+                        if (magnitude != 0) {
+                            // The endomorphism point of base i sits right after it in the point table
+                            const uint64_t point_idx = 2 * static_cast<uint64_t>(point_indices[i]) + half;
+                            workspace.schedule[num_entries++] =
+                                (point_idx << 32) | (static_cast<uint64_t>(is_negative) << SCHEDULE_NEGATE_BIT) |
+                                (magnitude - 1);
+                        }
+                    }
+                }
+                round_sums[round_idx] = evaluate_round<Curve>(point_table, workspace, num_entries, info.window_bits);
+            }
+        });
+
+        // Combine the rounds of each MSM: \sum_k 2^{k * window_bits} * W_k
+        for (size_t msm_idx = msm_begin; msm_idx < msm_end; ++msm_idx) {
+            const auto& info = msm_infos[msm_idx];
+            const size_t round_idx = round_offsets[msm_idx - msm_begin];
+            if (info.num_windows == 0) {
+                results[msm_idx] = AffineElement::infinity();
+                continue;
+            }
+            Element result = round_sums[round_idx + info.num_windows - 1];
+            for (size_t window = info.num_windows - 1; window > 0; --window) {
+                for (size_t i = 0; i < info.window_bits; ++i) {
+                    result.self_dbl();
+                }
+                result += round_sums[round_idx + window - 1];
+            }
+            results[msm_idx] = AffineElement(result);
+        }
+
+        chunk_begin = chunk_end;
+        msm_begin = msm_end;
+    }
+    return results;
+}
+
+template std::vector<curve::BN254::AffineElement> batch_msm_unsafe<curve::BN254>(
+    std::span<const curve::BN254::AffineElement> point_table,
+    std::span<const PolynomialSpan<const curve::BN254::ScalarField>> scalars);
+template std::vector<curve::Grumpkin::AffineElement> batch_msm_unsafe<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::AffineElement> point_table,
+    std::span<const PolynomialSpan<const curve::Grumpkin::ScalarField>> scalars);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+// Largest number of nonzero scalars a single MSM of batch_msm_unsafe may have
+constexpr size_t BATCH_MSM_MAX_NONZERO_SCALARS = 1UL << 20;
+
+/**
+ * @brief Compute several MSMs against the same pippenger point table together
+ *
+ * @details Calling pippenger once per MSM repeats its setup (scalar decomposition over the full, zero padded range,
+ * runtime state, bucket sorting) for every MSM, and parallelises each MSM on its own, which scales poorly when the MSMs
+ * are small. Here every MSM is split into pippenger rounds (one per window of the endomorphism half-scalars, using
+ * signed digits) and the rounds of all MSMs are scheduled together over the available threads. Each round sorts its
+ * entries into buckets and accumulates them with the affine trick (reduce_buckets) single-threaded, so no round pays
+ * for thread synchronisation. Zero scalars are dropped up front, so sparse scalar vectors cost only their nonzero
+ * entries.
+ *
+ * Like pippenger_unsafe, the incomplete affine addition formula is used: only sound when the bases are linearly
+ * independent (e.g. SRS points). Not for verifiers.
+ *
+ * @param point_table Pippenger point table (raw point at even indices, endomorphism point at odd indices)
+ * @param scalars The scalars of each MSM; scalars[j].start_index is the index of the base of its first scalar. Each
+ * may have at most BATCH_MSM_MAX_NONZERO_SCALARS nonzero scalars.
+ * @return One result per MSM
+ */
+template <typename Curve>
+std::vector<typename Curve::AffineElement> batch_msm_unsafe(
+    std::span<const typename Curve::AffineElement> point_table,
+    std::span<const PolynomialSpan<const typename Curve::ScalarField>> scalars);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,92 @@
+#include "barretenberg/ecc/scalar_multiplication/batched_msm.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace bb {
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+template <typename Curve> class BatchedMsmTests : public ::testing::Test {
+  public:
+    using G1 = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    static constexpr size_t NUM_POINTS = 1 << 11;
+
+    std::shared_ptr<G1[]> point_table;
+
+    void SetUp() override
+    {
+        point_table = scalar_multiplication::point_table_alloc<G1>(NUM_POINTS);
+        for (size_t i = 0; i < NUM_POINTS; ++i) {
+            point_table.get()[i] = G1(Element::random_element(&engine));
+        }
+        scalar_multiplication::generate_pippenger_point_table<Curve>(
+            point_table.get(), point_table.get(), NUM_POINTS);
+    }
+
+    std::span<const G1> get_point_table() const { return { point_table.get(), 2 * NUM_POINTS }; }
+
+    G1 naive_msm(PolynomialSpan<const Fr> scalars) const
+    {
+        Element result = Element::infinity();
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            result += point_table.get()[2 * (scalars.start_index + i)] * scalars.span[i];
+        }
+        return G1(result);
+    }
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+
+TYPED_TEST_SUITE(BatchedMsmTests, Curves);
+
+TYPED_TEST(BatchedMsmTests, MatchesNaiveMsm)
+{
+    using Fr = typename TestFixture::Fr;
+
+    // MSMs of various sizes and offsets, including empty, all-zero, sparse and single scalar ones
+    const std::vector<std::pair<size_t, size_t>> shapes = { { 0, 1000 }, { 37, 300 }, { 5, 0 },    { 0, 1 },
+                                                            { 1, 7 },    { 0, 2048 }, { 500, 64 }, { 0, 128 } };
+    std::vector<std::vector<Fr>> scalar_vectors;
+    for (const auto& [start_index, size] : shapes) {
+        std::vector<Fr> scalars(size);
+        for (auto& scalar : scalars) {
+            scalar = Fr::random_element(&engine);
+        }
+        scalar_vectors.push_back(std::move(scalars));
+    }
+    // Sparse
+    for (size_t i = 0; i < scalar_vectors[1].size(); ++i) {
+        if (i % 13 != 0) {
+            scalar_vectors[1][i] = Fr::zero();
+        }
+    }
+    // All zero
+    std::fill(scalar_vectors[7].begin(), scalar_vectors[7].end(), Fr::zero());
+    // Extreme values
+    scalar_vectors[0][0] = Fr::one();
+    scalar_vectors[0][1] = -Fr::one();
+    scalar_vectors[0][2] = Fr(2);
+
+    std::vector<PolynomialSpan<const Fr>> spans;
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        spans.emplace_back(shapes[i].first, scalar_vectors[i]);
+    }
+
+    auto results = scalar_multiplication::batch_msm_unsafe<TypeParam>(this->get_point_table(), spans);
+    ASSERT_EQ(results.size(), spans.size());
+    for (size_t i = 0; i < spans.size(); ++i) {
+        EXPECT_EQ(results[i], this->naive_msm(spans[i]));
+    }
+}
+
+} // namespace bb
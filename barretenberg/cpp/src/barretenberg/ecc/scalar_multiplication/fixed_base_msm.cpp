@@ -0,0 +1,264 @@
+#include "fixed_base_msm.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/ecc/scalar_multiplication/signed_digits.hpp"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+
+// Number of bases doubled and normalized together during precomputation
+constexpr size_t PRECOMPUTE_BLOCK_SIZE = 256;
+// Upper bound on the number of points gathered into contiguous memory for one batched affine addition. Batched
+// addition makes several passes over the gathered points, so keep them (and the addition scratch space) cache sized.
+constexpr size_t MAX_GATHER_SIZE = 1UL << 16;
+// How many entries ahead of the current one to prefetch table points while gathering
+constexpr size_t GATHER_PREFETCH_DISTANCE = 16;
+// Minimum number of scalars per thread when computing digits
+constexpr size_t MIN_SCALARS_PER_THREAD = 1UL << 12;
+
+// Flags packed into the low bits of a bucket entry; the table index occupies the remaining bits
+constexpr uint32_t ENTRY_NEGATE = 1;
+constexpr uint32_t ENTRY_ENDOMORPHISM = 2;
+constexpr uint32_t ENTRY_FLAG_BITS = 2;
+
+} // namespace
+
+template <typename Curve> size_t FixedBaseMsm<Curve>::min_memory_budget(size_t num_points)
+{
+    return get_num_windows(MAX_WINDOW_BITS) * num_points * sizeof(AffineElement);
+}
+
+template <typename Curve> size_t FixedBaseMsm<Curve>::choose_window_bits(size_t num_points, size_t memory_budget)
+{
+    const size_t max_windows = memory_budget / std::max(num_points * sizeof(AffineElement), sizeof(AffineElement));
+    size_t best_bits = 0;
+    size_t best_cost = std::numeric_limits<size_t>::max();
+    for (size_t bits = MIN_WINDOW_BITS; bits <= MAX_WINDOW_BITS; ++bits) {
+        const size_t windows = get_num_windows(bits);
+        if (windows > max_windows) {
+            continue;
+        }
+        // Two half-scalars per base each add one point per window into a bucket (batched affine additions); the
+        // bucket reduction costs two projective additions per bucket, roughly twice as expensive each.
+        const size_t cost = 2 * num_points * windows + 4 * (1UL << (bits - 1));
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_bits = bits;
+        }
+    }
+    return best_bits;
+}
+
+template <typename Curve>
+FixedBaseMsm<Curve>::FixedBaseMsm(std::span<const AffineElement> point_table, size_t num_points, size_t memory_budget)
+    : num_points(num_points)
+    , window_bits(choose_window_bits(num_points, memory_budget))
+{
+    PROFILE_THIS();
+
+    if (window_bits == 0) {
+        throw_or_abort(format("FixedBaseMsm: memory budget of ",
+                              memory_budget,
+                              " bytes is too small for ",
+                              num_points,
+                              " points, need at least ",
+                              min_memory_budget(num_points)));
+    }
+    ASSERT(point_table.size() >= 2 * num_points);
+    num_windows = get_num_windows(window_bits);
+    // Bucket entries pack the table index into 32 bits alongside the entry flags, a larger table would make them wrap.
+    if (num_windows * num_points >= (1UL << (32 - ENTRY_FLAG_BITS))) {
+        throw_or_abort(format("FixedBaseMsm: ",
+                              num_windows,
+                              " windows of ",
+                              num_points,
+                              " points exceed the ",
+                              1UL << (32 - ENTRY_FLAG_BITS),
+                              " table entries a bucket entry can index"));
+    }
+
+    tables = std::static_pointer_cast<AffineElement[]>(get_mem_slab(num_windows * num_points * sizeof(AffineElement)));
+    AffineElement* table = tables.get();
+
+    const size_t num_blocks = (num_points + PRECOMPUTE_BLOCK_SIZE - 1) / PRECOMPUTE_BLOCK_SIZE;
+    parallel_for(num_blocks, [&](size_t block_idx) {
+        const size_t start = block_idx * PRECOMPUTE_BLOCK_SIZE;
+        const size_t end = std::min(start + PRECOMPUTE_BLOCK_SIZE, num_points);
+        std::array<Element, PRECOMPUTE_BLOCK_SIZE> block;
+        for (size_t i = start; i < end; ++i) {
+            table[i] = point_table[2 * i];
+            block[i - start] = Element(point_table[2 * i]);
+        }
+        for (size_t k = 1; k < num_windows; ++k) {
+            for (size_t i = 0; i < end - start; ++i) {
+                for (size_t j = 0; j < window_bits; ++j) {
+                    block[i].self_dbl();
+                }
+            }
+            Element::batch_normalize(block.data(), end - start);
+            for (size_t i = start; i < end; ++i) {
+                table[k * num_points + i] = AffineElement(block[i - start].x, block[i - start].y);
+            }
+        }
+    });
+}
+
+template <typename Curve>
+typename FixedBaseMsm<Curve>::AffineElement FixedBaseMsm<Curve>::msm(PolynomialSpan<const ScalarField> scalars) const
+{
+    PROFILE_THIS();
+
+    ASSERT(scalars.end_index() <= num_points);
+    const size_t num_scalars = scalars.size();
+    const size_t num_buckets = 1UL << (window_bits - 1);
+
+    // Split the scalars with the endomorphism and count the (window, half-scalar) digits falling into each bucket.
+    // Each thread keeps its own histogram so the entries can be scattered into bucket order without synchronisation.
+    const size_t num_threads =
+        std::max(1UL, std::min(get_num_cpus(), (num_scalars + MIN_SCALARS_PER_THREAD - 1) / MIN_SCALARS_PER_THREAD));
+    const size_t scalars_per_thread = (num_scalars + num_threads - 1) / num_threads;
+    std::vector<std::array<uint64_t, 4>> split_scalars(num_scalars);
+    std::vector<std::vector<uint32_t>> thread_bucket_offsets(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * scalars_per_thread, num_scalars);
+        const size_t end = std::min(start + scalars_per_thread, num_scalars);
+        auto& counts = thread_bucket_offsets[thread_idx];
+        counts.assign(num_buckets, 0);
+        const auto count_digit = [&](size_t, uint64_t magnitude, bool) { counts[magnitude - 1]++; };
+        for (size_t i = start; i < end; ++i) {
+            ScalarField k = scalars.span[i].from_montgomery_form();
+            ScalarField::split_into_endomorphism_scalars(k, k, *reinterpret_cast<ScalarField*>(&k.data[2]));
+            std::copy(std::begin(k.data), std::end(k.data), split_scalars[i].begin());
+            for_each_signed_digit(&split_scalars[i][0], window_bits, num_windows, count_digit);
+            for_each_signed_digit(&split_scalars[i][2], window_bits, num_windows, count_digit);
+        }
+    });
+
+    // Turn the per-thread counts into per-thread write offsets within bucket-sorted storage
+    std::vector<size_t> bucket_counts(num_buckets, 0);
+    size_t num_entries = 0;
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            const uint32_t count = thread_bucket_offsets[thread_idx][bucket];
+            thread_bucket_offsets[thread_idx][bucket] = static_cast<uint32_t>(num_entries);
+            num_entries += count;
+            bucket_counts[bucket] += count;
+        }
+    }
+    if (num_entries == 0) {
+        return AffineElement::infinity();
+    }
+    ASSERT(num_entries <= std::numeric_limits<uint32_t>::max());
+
+    std::vector<uint32_t> entries(num_entries);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * scalars_per_thread, num_scalars);
+        const size_t end = std::min(start + scalars_per_thread, num_scalars);
+        auto& offsets = thread_bucket_offsets[thread_idx];
+        for (size_t i = start; i < end; ++i) {
+            const size_t base_idx = scalars.start_index + i;
+            for (uint32_t half = 0; half < 2; ++half) {
+                for_each_signed_digit(
+                    &split_scalars[i][2 * half], window_bits, num_windows, [&](size_t k, uint64_t magnitude, bool neg) {
+                        const auto table_idx = static_cast<uint32_t>(k * num_points + base_idx);
+                        entries[offsets[magnitude - 1]++] = (table_idx << ENTRY_FLAG_BITS) |
+                                                            (half == 1 ? ENTRY_ENDOMORPHISM : 0) |
+                                                            (neg ? ENTRY_NEGATE : 0);
+                    });
+            }
+        }
+    });
+
+    // Accumulate the buckets. Runs of consecutive buckets are gathered into contiguous memory (applying the
+    // endomorphism and signs) and each bucket is summed with batched affine additions.
+    const BaseField beta = BaseField::cube_root_of_unity();
+    const AffineElement* table = tables.get();
+    std::vector<AffineElement> bucket_sums(num_buckets);
+    std::vector<uint8_t> bucket_nonempty(num_buckets, 0);
+    std::vector<AffineElement> gathered(std::min(num_entries, MAX_GATHER_SIZE));
+    size_t entry_start = 0;
+    size_t bucket_start = 0;
+    while (bucket_start < num_buckets) {
+        // Always take at least one bucket, even if it alone exceeds the gather size
+        std::vector<size_t> sequence_counts;
+        std::vector<size_t> sequence_buckets;
+        size_t gather_size = 0;
+        size_t bucket_end = bucket_start;
+        while (bucket_end < num_buckets &&
+               (gather_size == 0 || gather_size + bucket_counts[bucket_end] <= MAX_GATHER_SIZE)) {
+            if (bucket_counts[bucket_end] > 0) {
+                sequence_counts.push_back(bucket_counts[bucket_end]);
+                sequence_buckets.push_back(bucket_end);
+                gather_size += bucket_counts[bucket_end];
+            }
+            ++bucket_end;
+        }
+        if (gather_size > gathered.size()) {
+            gathered.resize(gather_size);
+        }
+        if (gather_size > 0) {
+            const uint32_t* group_entries = &entries[entry_start];
+            std::span<AffineElement> group_points(gathered.data(), gather_size);
+            parallel_for_range(gather_size, [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i) {
+                    // Entries are in bucket order, so table reads are effectively random and miss cache
+                    if (i + GATHER_PREFETCH_DISTANCE < end) {
+                        __builtin_prefetch(&table[group_entries[i + GATHER_PREFETCH_DISTANCE] >> ENTRY_FLAG_BITS]);
+                    }
+                    const uint32_t entry = group_entries[i];
+                    const AffineElement& point = table[entry >> ENTRY_FLAG_BITS];
+                    // The endomorphism point is (\beta * x, -y)
+                    const bool endomorphism = (entry & ENTRY_ENDOMORPHISM) != 0;
+                    const bool negate_y = endomorphism != ((entry & ENTRY_NEGATE) != 0);
+                    group_points[i].x = endomorphism ? point.x * beta : point.x;
+                    group_points[i].y = negate_y ? -point.y : point.y;
+                }
+            });
+            auto sums = BatchedAffineAddition<Curve>::add_in_place(group_points, sequence_counts);
+            for (size_t i = 0; i < sums.size(); ++i) {
+                bucket_sums[sequence_buckets[i]] = sums[i];
+                bucket_nonempty[sequence_buckets[i]] = 1;
+            }
+        }
+        entry_start += gather_size;
+        bucket_start = bucket_end;
+    }
+
+    // Reduce \sum_b (b + 1) * B_b with running sums, in parallel over ranges of buckets. A thread owning buckets
+    // [lo, hi) computes A = \sum_{b in [lo, hi)} (b - lo + 1) * B_b and S = \sum_{b in [lo, hi)} B_b, contributing
+    // A + lo * S.
+    const size_t num_reduction_threads = std::max(1UL, std::min(get_num_cpus(), num_buckets / 1024));
+    const size_t buckets_per_thread = (num_buckets + num_reduction_threads - 1) / num_reduction_threads;
+    std::vector<Element> thread_results(num_reduction_threads);
+    parallel_for(num_reduction_threads, [&](size_t thread_idx) {
+        const size_t lo = std::min(thread_idx * buckets_per_thread, num_buckets);
+        const size_t hi = std::min(lo + buckets_per_thread, num_buckets);
+        Element running_sum = Element::infinity();
+        Element accumulator = Element::infinity();
+        for (size_t bucket = hi; bucket > lo; --bucket) {
+            if (bucket_nonempty[bucket - 1] != 0) {
+                running_sum += bucket_sums[bucket - 1];
+            }
+            accumulator += running_sum;
+        }
+        thread_results[thread_idx] = lo > 0 ? accumulator + running_sum * ScalarField(lo) : accumulator;
+    });
+
+    Element result = Element::infinity();
+    for (const auto& thread_result : thread_results) {
+        result += thread_result;
+    }
+    return AffineElement(result);
+}
+
+template class FixedBaseMsm<curve::BN254>;
+template class FixedBaseMsm<curve::Grumpkin>;
+
+} // namespace bb::scalar_multiplication
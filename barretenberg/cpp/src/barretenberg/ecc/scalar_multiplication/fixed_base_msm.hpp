@@ -0,0 +1,84 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Multi-scalar multiplication against a fixed set of bases, using precomputed multiples of the bases.
+ *
+ * @details Generic pippenger splits each (endomorphism-reduced, ~128 bit) scalar into c-bit windows and runs one round
+ * of bucket accumulation + bucket reduction per window, doubling the accumulator c times between rounds. When the bases
+ * never change, as for commitments against an SRS prefix, we can instead precompute for every base P_i the multiples
+ * 2^{c * k} * P_i for each window k. An MSM then becomes a single pippenger round over num_windows * num_points
+ * (point, digit) pairs: every pair is added into one shared set of 2^{c-1} buckets (signed digits) and the buckets are
+ * reduced once, with no doublings. This removes (num_windows - 1) bucket reductions per MSM and lets the window size be
+ * picked from the memory budget rather than from the MSM size.
+ *
+ * The endomorphism points (\beta * x, -y) of the pippenger point table are not stored in the precomputed tables; they
+ * are derived on the fly (one field multiplication) when a digit of the second half-scalar selects them, which halves
+ * the memory footprint.
+ *
+ * Bucket accumulation uses BatchedAffineAddition and thus the incomplete affine addition formula: like
+ * pippenger_unsafe, this is only sound when the bases are linearly independent (e.g. SRS points). Not for verifiers.
+ */
+template <typename Curve> class FixedBaseMsm {
+  public:
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using ScalarField = typename Curve::ScalarField;
+    using BaseField = typename Curve::BaseField;
+
+    // Bit length of the half-scalars produced by the endomorphism split
+    static constexpr size_t SCALAR_BITS = 128;
+    static constexpr size_t MIN_WINDOW_BITS = 4;
+    static constexpr size_t MAX_WINDOW_BITS = 22;
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 1UL << 30;
+
+    /**
+     * @brief Precompute the window tables for the first num_points bases of a pippenger point table.
+     *
+     * @param point_table Pippenger point table (raw bases at even indices), holding at least 2 * num_points points
+     * @param num_points Number of bases to precompute
+     * @param memory_budget Maximum size in bytes of the precomputed tables; determines the window size
+     */
+    FixedBaseMsm(std::span<const AffineElement> point_table,
+                 size_t num_points,
+                 size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+    /**
+     * @brief Compute \sum_i scalars[i] * P_{scalars.start_index + i}
+     */
+    AffineElement msm(PolynomialSpan<const ScalarField> scalars) const;
+
+    size_t get_num_points() const { return num_points; }
+    size_t get_window_bits() const { return window_bits; }
+    size_t get_num_windows() const { return num_windows; }
+
+    /**
+     * @brief Smallest memory budget with which num_points bases can be precomputed
+     */
+    static size_t min_memory_budget(size_t num_points);
+
+    /**
+     * @brief Choose the window size minimising the estimated MSM cost within the memory budget; 0 if none fits
+     */
+    static size_t choose_window_bits(size_t num_points, size_t memory_budget);
+
+  private:
+    static size_t get_num_windows(size_t window_bits) { return (SCALAR_BITS + window_bits) / window_bits; }
+
+    size_t num_points;
+    size_t window_bits;
+    size_t num_windows;
+    // Window-major: tables[k * num_points + i] = 2^{k * window_bits} * P_i
+    std::shared_ptr<AffineElement[]> tables;
+};
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,105 @@
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace bb {
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+template <typename Curve> class FixedBaseMsmTests : public ::testing::Test {
+  public:
+    using G1 = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+    using FixedBaseMsm = scalar_multiplication::FixedBaseMsm<Curve>;
+
+    static constexpr size_t NUM_POINTS = 1 << 10;
+
+    std::shared_ptr<G1[]> point_table;
+
+    void SetUp() override
+    {
+        point_table = scalar_multiplication::point_table_alloc<G1>(NUM_POINTS);
+        for (size_t i = 0; i < NUM_POINTS; ++i) {
+            point_table.get()[i] = G1(Element::random_element(&engine));
+        }
+        scalar_multiplication::generate_pippenger_point_table<Curve>(
+            point_table.get(), point_table.get(), NUM_POINTS);
+    }
+
+    std::span<const G1> get_point_table() const { return { point_table.get(), 2 * NUM_POINTS }; }
+
+    G1 naive_msm(PolynomialSpan<const Fr> scalars) const
+    {
+        Element result = Element::infinity();
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            result += point_table.get()[2 * (scalars.start_index + i)] * scalars.span[i];
+        }
+        return G1(result);
+    }
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+
+TYPED_TEST_SUITE(FixedBaseMsmTests, Curves);
+
+TYPED_TEST(FixedBaseMsmTests, MatchesNaiveMsm)
+{
+    using Fr = typename TestFixture::Fr;
+    using FixedBaseMsm = typename TestFixture::FixedBaseMsm;
+
+    // Exercise both a small window (many windows) and the largest window permitted by a small budget
+    for (size_t memory_budget : { size_t(1) << 26, FixedBaseMsm::min_memory_budget(TestFixture::NUM_POINTS) }) {
+        FixedBaseMsm msm(this->get_point_table(), TestFixture::NUM_POINTS, memory_budget);
+        EXPECT_LE(msm.get_num_windows() * TestFixture::NUM_POINTS * sizeof(typename TestFixture::G1), memory_budget);
+
+        std::vector<Fr> scalars(TestFixture::NUM_POINTS);
+        for (auto& scalar : scalars) {
+            scalar = Fr::random_element(&engine);
+        }
+        PolynomialSpan<const Fr> full{ 0, scalars };
+        EXPECT_EQ(msm.msm(full), this->naive_msm(full));
+
+        // Scalars starting at an offset into the bases, with a run of zeros and some small/extreme values
+        const size_t start_index = 37;
+        std::vector<Fr> offset_scalars(300);
+        for (auto& scalar : offset_scalars) {
+            scalar = Fr::random_element(&engine);
+        }
+        std::fill(offset_scalars.begin() + 10, offset_scalars.begin() + 50, Fr::zero());
+        offset_scalars[60] = Fr::one();
+        offset_scalars[61] = -Fr::one();
+        offset_scalars[62] = Fr(2);
+        PolynomialSpan<const Fr> offset{ start_index, offset_scalars };
+        EXPECT_EQ(msm.msm(offset), this->naive_msm(offset));
+    }
+}
+
+TYPED_TEST(FixedBaseMsmTests, ZeroScalars)
+{
+    using Fr = typename TestFixture::Fr;
+    using FixedBaseMsm = typename TestFixture::FixedBaseMsm;
+
+    FixedBaseMsm msm(this->get_point_table(), TestFixture::NUM_POINTS);
+    std::vector<Fr> scalars(TestFixture::NUM_POINTS, Fr::zero());
+    EXPECT_TRUE(msm.msm({ 0, scalars }).is_point_at_infinity());
+}
+
+TYPED_TEST(FixedBaseMsmTests, RejectsInsufficientMemoryBudget)
+{
+    using FixedBaseMsm = typename TestFixture::FixedBaseMsm;
+
+    EXPECT_EQ(FixedBaseMsm::choose_window_bits(TestFixture::NUM_POINTS,
+                                               FixedBaseMsm::min_memory_budget(TestFixture::NUM_POINTS) - 1),
+              0);
+    EXPECT_THROW(FixedBaseMsm(this->get_point_table(), TestFixture::NUM_POINTS, 1024), std::runtime_error);
+}
+
+} // namespace bb
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "barretenberg/common/assert.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Extract window_bits bits of a 128 bit scalar (two little-endian limbs) starting at bit_offset
+ */
+inline uint64_t get_scalar_window(const uint64_t* scalar, size_t bit_offset, size_t window_bits)
+{
+    uint64_t bits = 0;
+    if (bit_offset < 64) {
+        bits = scalar[0] >> bit_offset;
+        if (bit_offset + window_bits > 64 && bit_offset > 0) {
+            bits |= scalar[1] << (64 - bit_offset);
+        }
+    } else if (bit_offset < 128) {
+        bits = scalar[1] >> (bit_offset - 64);
+    }
+    return bits & ((1ULL << window_bits) - 1);
+}
+
+/**
+ * @brief Signed-digit recoding of a 128 bit scalar into num_windows digits in [-2^{c-1}, 2^{c-1}], calling
+ * on_digit(window, magnitude, is_negative) for each nonzero digit
+ * @details Requires window_bits * num_windows >= 129 so that the final carry is absorbed.
+ */
+template <typename Func>
+void for_each_signed_digit(const uint64_t* scalar, size_t window_bits, size_t num_windows, const Func& on_digit)
+{
+    const uint64_t half = 1ULL << (window_bits - 1);
+    const uint64_t full = 1ULL << window_bits;
+    uint64_t carry = 0;
+    for (size_t k = 0; k < num_windows; ++k) {
+        const uint64_t raw = get_scalar_window(scalar, k * window_bits, window_bits) + carry;
+        if (raw > half) {
+            carry = 1;
+            if (raw != full) {
+                on_digit(k, full - raw, true);
+            }
+        } else {
+            carry = 0;
+            if (raw != 0) {
+                on_digit(k, raw, false);
+            }
+        }
+    }
+    ASSERT(carry == 0);
+}
+
+/**
+ * @brief Random access to the signed digits produced by for_each_signed_digit
+ * @details The digits d_k lie in [-(2^{c-1} - 1), 2^{c-1}] and are unique, so they are the base-2^c digits of
+ * scalar + offset, each shifted down by 2^{c-1} - 1, where offset = \sum_k (2^{c-1} - 1) * 2^{k * c}. This gives any
+ * digit in constant time, without propagating carries from the lower windows.
+ */
+class SignedDigits {
+  public:
+    SignedDigits(size_t window_bits, size_t num_windows)
+        : window_bits(window_bits)
+        , digit_shift((1ULL << (window_bits - 1)) - 1)
+    {
+        ASSERT(window_bits * num_windows <= 64 * NUM_LIMBS - 1);
+        for (size_t k = 0; k < num_windows; ++k) {
+            const size_t bit = k * window_bits;
+            offset[bit / 64] |= digit_shift << (bit % 64);
+            if (bit % 64 + window_bits > 64) {
+                offset[bit / 64 + 1] |= digit_shift >> (64 - bit % 64);
+            }
+        }
+    }
+
+    /**
+     * @brief The digit of a 128 bit scalar (two little-endian limbs) in the given window
+     * @return The digit magnitude (0 if the digit is zero); is_negative is set to the digit's sign
+     */
+    uint64_t get(const uint64_t* scalar, size_t window, bool& is_negative) const
+    {
+        // shifted = scalar + offset
+        std::array<uint64_t, NUM_LIMBS> shifted;
+        uint64_t carry = 0;
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            const uint64_t limb = i < 2 ? scalar[i] : 0;
+            const uint64_t sum = limb + offset[i];
+            const uint64_t sum_with_carry = sum + carry;
+            carry = static_cast<uint64_t>(sum < limb) + static_cast<uint64_t>(sum_with_carry < sum);
+            shifted[i] = sum_with_carry;
+        }
+        const size_t bit = window * window_bits;
+        uint64_t bits = shifted[bit / 64] >> (bit % 64);
+        if (bit % 64 + window_bits > 64) {
+            bits |= shifted[bit / 64 + 1] << (64 - bit % 64);
+        }
+        bits &= (1ULL << window_bits) - 1;
+        is_negative = bits < digit_shift;
+        return is_negative ? digit_shift - bits : bits - digit_shift;
+    }
+
+  private:
+    static constexpr size_t NUM_LIMBS = 3;
+    size_t window_bits;
+    uint64_t digit_shift;
+    std::array<uint64_t, NUM_LIMBS> offset{};
+};
+
+} // namespace bb::scalar_multiplication
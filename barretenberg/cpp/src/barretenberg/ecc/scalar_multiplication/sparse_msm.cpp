@@ -0,0 +1,266 @@
+#include "sparse_msm.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/ecc/scalar_multiplication/batched_msm.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <algorithm>
+#include <array>
+
+namespace bb::scalar_multiplication {
+
+namespace {
+
+constexpr size_t NUM_SCALAR_CLASSES = static_cast<size_t>(ScalarClass::FULL) + 1;
+
+using ClassCounts = std::array<size_t, NUM_SCALAR_CLASSES>;
+
+// Smallest MSM the small scalars are split into when spreading them over threads
+constexpr size_t MIN_SMALL_MSM_SIZE = 1UL << 16;
+// Number of scalars likely_sparse looks at, and how far (in percent) above ScalarClassification::DENSITY_THRESHOLD
+// the density of the sample may be while the scalars are still classified
+constexpr size_t DENSITY_SAMPLE_SIZE = 1024;
+constexpr size_t DENSITY_SAMPLE_MARGIN = 10;
+
+template <typename Fr> ScalarClass classify_scalar(const Fr& scalar, const Fr& minus_one)
+{
+    if (scalar.is_zero()) {
+        return ScalarClass::ZERO;
+    }
+    if (scalar == Fr::one()) {
+        return ScalarClass::UNIT;
+    }
+    if (scalar == minus_one) {
+        return ScalarClass::NEGATIVE_UNIT;
+    }
+    const Fr value = scalar.from_montgomery_form();
+    if ((value.data[1] | value.data[2] | value.data[3]) == 0) {
+        return ScalarClass::SMALL;
+    }
+    const uint256_t negated = Fr::modulus - uint256_t(value.data[0], value.data[1], value.data[2], value.data[3]);
+    if ((negated.data[1] | negated.data[2] | negated.data[3]) == 0) {
+        return ScalarClass::NEGATIVE_SMALL;
+    }
+    return ScalarClass::FULL;
+}
+
+// The scalars are processed in the same contiguous per-thread ranges by classify_scalars and sparse_msm_unsafe
+struct ThreadRanges {
+    size_t num_threads;
+    size_t block_size;
+
+    explicit ThreadRanges(size_t num_scalars)
+        : num_threads(calculate_num_threads(num_scalars))
+        , block_size((num_scalars + num_threads - 1) / num_threads)
+    {}
+};
+
+} // namespace
+
+template <typename Curve>
+ScalarClassification classify_scalars(PolynomialSpan<const typename Curve::ScalarField> scalars)
+{
+    BB_OP_COUNT_TIME();
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_scalars = scalars.size();
+    const ThreadRanges ranges(num_scalars);
+    const Fr minus_one = -Fr::one();
+
+    ScalarClassification classification;
+    classification.classes.resize(num_scalars);
+    std::vector<ClassCounts> thread_counts(ranges.num_threads, ClassCounts{});
+    parallel_for(ranges.num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * ranges.block_size;
+        const size_t end = std::min(num_scalars, start + ranges.block_size);
+        for (size_t idx = start; idx < end; ++idx) {
+            const ScalarClass scalar_class = classify_scalar(scalars.span[idx], minus_one);
+            classification.classes[idx] = scalar_class;
+            ++thread_counts[thread_idx][static_cast<size_t>(scalar_class)];
+        }
+    });
+
+    for (const auto& counts : thread_counts) {
+        classification.num_zero += counts[static_cast<size_t>(ScalarClass::ZERO)];
+        classification.num_unit +=
+            counts[static_cast<size_t>(ScalarClass::UNIT)] + counts[static_cast<size_t>(ScalarClass::NEGATIVE_UNIT)];
+        classification.num_small +=
+            counts[static_cast<size_t>(ScalarClass::SMALL)] + counts[static_cast<size_t>(ScalarClass::NEGATIVE_SMALL)];
+        classification.num_full += counts[static_cast<size_t>(ScalarClass::FULL)];
+    }
+    return classification;
+}
+
+template <typename Curve> bool likely_sparse(PolynomialSpan<const typename Curve::ScalarField> scalars)
+{
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_scalars = scalars.size();
+    if (num_scalars <= DENSITY_SAMPLE_SIZE) {
+        return true;
+    }
+    const Fr minus_one = -Fr::one();
+    // Golden ratio (Weyl) sequence of positions: evenly spread and without the stride a periodic layout could alias
+    constexpr uint64_t GOLDEN_RATIO_64 = 0x9E3779B97F4A7C15ULL;
+    size_t num_full = 0;
+    size_t num_small = 0;
+    uint64_t position = 0;
+    for (size_t i = 0; i < DENSITY_SAMPLE_SIZE; ++i) {
+        position += GOLDEN_RATIO_64;
+        // Scale the top 32 bits of the position to [0, num_scalars), polynomials have far fewer than 2^32 coefficients
+        const auto idx = static_cast<size_t>(((position >> 32) * num_scalars) >> 32);
+        switch (classify_scalar(scalars.span[idx], minus_one)) {
+        case ScalarClass::FULL:
+            ++num_full;
+            break;
+        case ScalarClass::SMALL:
+        case ScalarClass::NEGATIVE_SMALL:
+            ++num_small;
+            break;
+        default:
+            break;
+        }
+    }
+    // Same estimate as ScalarClassification::effective_density
+    const size_t sample_density = (num_full * 4 + num_small) * 100 / (DENSITY_SAMPLE_SIZE * 4);
+    return sample_density < ScalarClassification::DENSITY_THRESHOLD + DENSITY_SAMPLE_MARGIN;
+}
+
+template <typename Curve>
+typename Curve::AffineElement sparse_msm_unsafe(PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                                const ScalarClassification& classification,
+                                                std::span<const typename Curve::AffineElement> point_table,
+                                                pippenger_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TIME();
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    const size_t num_scalars = scalars.size();
+    ASSERT(classification.classes.size() == num_scalars);
+    ASSERT(2 * scalars.end_index() <= point_table.size());
+    const ThreadRanges ranges(num_scalars);
+
+    // Offsets of each thread's unit, small and full inputs within the compacted arrays
+    std::vector<std::array<size_t, 3>> thread_offsets(ranges.num_threads, { 0, 0, 0 });
+    parallel_for(ranges.num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * ranges.block_size;
+        const size_t end = std::min(num_scalars, start + ranges.block_size);
+        for (size_t idx = start; idx < end; ++idx) {
+            switch (classification.classes[idx]) {
+            case ScalarClass::UNIT:
+            case ScalarClass::NEGATIVE_UNIT:
+                ++thread_offsets[thread_idx][0];
+                break;
+            case ScalarClass::SMALL:
+            case ScalarClass::NEGATIVE_SMALL:
+                ++thread_offsets[thread_idx][1];
+                break;
+            case ScalarClass::FULL:
+                ++thread_offsets[thread_idx][2];
+                break;
+            case ScalarClass::ZERO:
+                break;
+            }
+        }
+    });
+    std::array<size_t, 3> totals = { 0, 0, 0 };
+    for (auto& offsets : thread_offsets) {
+        for (size_t i = 0; i < 3; ++i) {
+            const size_t count = offsets[i];
+            offsets[i] = totals[i];
+            totals[i] += count;
+        }
+    }
+    ASSERT(totals[0] == classification.num_unit && totals[1] == classification.num_small &&
+           totals[2] == classification.num_full);
+
+    // Compact the inputs. Negative units and small scalars are replaced by their negation, with the bases negated
+    // instead. Small and full scalars keep both the raw point and the endomorphism point, as pippenger expects.
+    std::vector<AffineElement> unit_points(classification.num_unit);
+    std::vector<Fr> small_scalars(classification.num_small);
+    std::vector<AffineElement> small_points(2 * classification.num_small);
+    std::vector<Fr> full_scalars(classification.num_full);
+    std::vector<AffineElement> full_points(2 * classification.num_full);
+    parallel_for(ranges.num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * ranges.block_size;
+        const size_t end = std::min(num_scalars, start + ranges.block_size);
+        auto [unit_idx, small_idx, full_idx] = thread_offsets[thread_idx];
+        for (size_t idx = start; idx < end; ++idx) {
+            const size_t point_idx = 2 * (scalars.start_index + idx);
+            switch (classification.classes[idx]) {
+            case ScalarClass::UNIT:
+                unit_points[unit_idx++] = point_table[point_idx];
+                break;
+            case ScalarClass::NEGATIVE_UNIT:
+                unit_points[unit_idx++] = -point_table[point_idx];
+                break;
+            case ScalarClass::SMALL:
+                small_scalars[small_idx] = scalars.span[idx];
+                small_points[2 * small_idx] = point_table[point_idx];
+                small_points[2 * small_idx + 1] = point_table[point_idx + 1];
+                ++small_idx;
+                break;
+            case ScalarClass::NEGATIVE_SMALL:
+                small_scalars[small_idx] = -scalars.span[idx];
+                small_points[2 * small_idx] = -point_table[point_idx];
+                small_points[2 * small_idx + 1] = -point_table[point_idx + 1];
+                ++small_idx;
+                break;
+            case ScalarClass::FULL:
+                full_scalars[full_idx] = scalars.span[idx];
+                full_points[2 * full_idx] = point_table[point_idx];
+                full_points[2 * full_idx + 1] = point_table[point_idx + 1];
+                ++full_idx;
+                break;
+            case ScalarClass::ZERO:
+                break;
+            }
+        }
+    });
+
+    Element result = Element::infinity();
+    if (!unit_points.empty()) {
+        result += BatchedAffineAddition<Curve>::add_in_place(unit_points, { unit_points.size() })[0];
+    }
+    if (!small_scalars.empty()) {
+        // Split the small scalars into several MSMs, within the batch MSM bound and so that their rounds spread over
+        // the threads
+        const size_t piece_size = std::clamp((small_scalars.size() + get_num_cpus() - 1) / get_num_cpus(),
+                                             MIN_SMALL_MSM_SIZE,
+                                             BATCH_MSM_MAX_NONZERO_SCALARS);
+        std::vector<PolynomialSpan<const Fr>> small_msms;
+        for (size_t start = 0; start < small_scalars.size(); start += piece_size) {
+            const size_t size = std::min(piece_size, small_scalars.size() - start);
+            small_msms.emplace_back(start, std::span<const Fr>(small_scalars).subspan(start, size));
+        }
+        for (const auto& small_result : batch_msm_unsafe<Curve>(small_points, small_msms)) {
+            result += small_result;
+        }
+    }
+    if (!full_scalars.empty()) {
+        result += pippenger_unsafe<Curve>({ 0, full_scalars }, full_points, state);
+    }
+    return AffineElement(result);
+}
+
+template ScalarClassification classify_scalars<curve::BN254>(PolynomialSpan<const curve::BN254::ScalarField> scalars);
+template ScalarClassification classify_scalars<curve::Grumpkin>(
+    PolynomialSpan<const curve::Grumpkin::ScalarField> scalars);
+template bool likely_sparse<curve::BN254>(PolynomialSpan<const curve::BN254::ScalarField> scalars);
+template bool likely_sparse<curve::Grumpkin>(PolynomialSpan<const curve::Grumpkin::ScalarField> scalars);
+
+template curve::BN254::AffineElement sparse_msm_unsafe<curve::BN254>(
+    PolynomialSpan<const curve::BN254::ScalarField> scalars,
+    const ScalarClassification& classification,
+    std::span<const curve::BN254::AffineElement> point_table,
+    pippenger_runtime_state<curve::BN254>& state);
+template curve::Grumpkin::AffineElement sparse_msm_unsafe<curve::Grumpkin>(
+    PolynomialSpan<const curve::Grumpkin::ScalarField> scalars,
+    const ScalarClassification& classification,
+    std::span<const curve::Grumpkin::AffineElement> point_table,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/runtime_states.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Kind of scalar, by the cost of multiplying a base by it
+ * @details UNIT and SMALL cover both signs (±1 and ±k with k < 2^64); the sign is applied to the base.
+ */
+enum class ScalarClass : uint8_t { ZERO, UNIT, NEGATIVE_UNIT, SMALL, NEGATIVE_SMALL, FULL };
+
+/**
+ * @brief Per-scalar classes of an MSM input along with the number of scalars of each kind
+ */
+struct ScalarClassification {
+    // Cost of the MSM with the sparse front-end, in percent of a dense pippenger, below which it is used
+    static constexpr size_t DENSITY_THRESHOLD = 75;
+
+    std::vector<ScalarClass> classes;
+    size_t num_zero = 0;
+    size_t num_unit = 0;
+    size_t num_small = 0;
+    size_t num_full = 0;
+
+    /**
+     * @brief Estimated cost of the MSM with the sparse front-end relative to a dense pippenger, in percent
+     * @details Zeros are free and units cost one affine addition; small scalars have a quarter of the bits of the two
+     * endomorphism half-scalars of a full scalar.
+     */
+    size_t effective_density() const
+    {
+        return classes.empty() ? 0 : (num_full * 4 + num_small) * 100 / (classes.size() * 4);
+    }
+
+    bool is_sparse() const { return effective_density() < DENSITY_THRESHOLD; }
+};
+
+/**
+ * @brief Classify the scalars of an MSM in one (multithreaded) pass
+ */
+template <typename Curve>
+ScalarClassification classify_scalars(PolynomialSpan<const typename Curve::ScalarField> scalars);
+
+/**
+ * @brief Whether classify_scalars is worth running, judged from a sample of the scalars
+ * @details Classifying costs a pass over the scalars and a class per scalar, wasted on dense polynomials. The sample
+ * is spread over the whole range, so blocks of zeros (e.g. the unused rows of a structured trace) are seen in
+ * proportion. The sample must look clearly dense for the full classification to be skipped, and polynomials too small
+ * to sample are always classified.
+ */
+template <typename Curve> bool likely_sparse(PolynomialSpan<const typename Curve::ScalarField> scalars);
+
+/**
+ * @brief MSM front-end for scalars that are mostly zero, ±1 or small, such as selectors and the wires of a structured
+ * execution trace
+ *
+ * @details Zeros are dropped. The bases of ±1 scalars are summed with batched affine addition
+ * (BatchedAffineAddition). Small scalars go through batch_msm_unsafe, whose rounds skip the empty high windows and the
+ * (zero) second endomorphism half-scalar. Only the remaining full scalars are sent to pippenger, over a compacted copy
+ * of their bases.
+ *
+ * Like pippenger_unsafe, the incomplete affine addition formula is used: only sound when the bases are linearly
+ * independent (e.g. SRS points). Not for verifiers.
+ *
+ * @param scalars The scalars; scalars.start_index is the index of the base of the first scalar
+ * @param classification classify_scalars(scalars)
+ * @param point_table Pippenger point table (raw point at even indices, endomorphism point at odd indices)
+ * @param state Pippenger runtime state holding at least classification.num_full points
+ */
+template <typename Curve>
+typename Curve::AffineElement sparse_msm_unsafe(PolynomialSpan<const typename Curve::ScalarField> scalars,
+                                                const ScalarClassification& classification,
+                                                std::span<const typename Curve::AffineElement> point_table,
+                                                pippenger_runtime_state<Curve>& state);
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,147 @@
+#include "barretenberg/ecc/scalar_multiplication/sparse_msm.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace bb {
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+template <typename Curve> class SparseMsmTests : public ::testing::Test {
+  public:
+    using G1 = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    static constexpr size_t NUM_POINTS = 1 << 11;
+
+    std::shared_ptr<G1[]> point_table;
+
+    void SetUp() override
+    {
+        point_table = scalar_multiplication::point_table_alloc<G1>(NUM_POINTS);
+        for (size_t i = 0; i < NUM_POINTS; ++i) {
+            point_table.get()[i] = G1(Element::random_element(&engine));
+        }
+        scalar_multiplication::generate_pippenger_point_table<Curve>(
+            point_table.get(), point_table.get(), NUM_POINTS);
+    }
+
+    std::span<const G1> get_point_table() const { return { point_table.get(), 2 * NUM_POINTS }; }
+
+    G1 naive_msm(PolynomialSpan<const Fr> scalars) const
+    {
+        Element result = Element::infinity();
+        for (size_t i = 0; i < scalars.size(); ++i) {
+            result += point_table.get()[2 * (scalars.start_index + i)] * scalars.span[i];
+        }
+        return G1(result);
+    }
+};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+
+TYPED_TEST_SUITE(SparseMsmTests, Curves);
+
+TYPED_TEST(SparseMsmTests, ClassifiesScalars)
+{
+    using Fr = typename TestFixture::Fr;
+    using scalar_multiplication::ScalarClass;
+
+    const std::vector<Fr> scalars = {
+        Fr::zero(), Fr::one(), -Fr::one(), Fr(2), -Fr(3), Fr(uint256_t(0, 1, 0, 0)), Fr::random_element(&engine)
+    };
+    auto classification = scalar_multiplication::classify_scalars<TypeParam>({ 0, scalars });
+
+    const std::vector<ScalarClass> expected = {
+        ScalarClass::ZERO,           ScalarClass::UNIT, ScalarClass::NEGATIVE_UNIT, ScalarClass::SMALL,
+        ScalarClass::NEGATIVE_SMALL, ScalarClass::FULL, ScalarClass::FULL
+    };
+    EXPECT_EQ(classification.classes, expected);
+    EXPECT_EQ(classification.num_zero, 1);
+    EXPECT_EQ(classification.num_unit, 2);
+    EXPECT_EQ(classification.num_small, 2);
+    EXPECT_EQ(classification.num_full, 2);
+}
+
+TYPED_TEST(SparseMsmTests, SamplesDensityBeforeClassifying)
+{
+    using Fr = typename TestFixture::Fr;
+
+    const size_t size = 1 << 14;
+    std::vector<Fr> dense(size);
+    for (auto& scalar : dense) {
+        scalar = Fr::random_element(&engine);
+    }
+    EXPECT_FALSE(scalar_multiplication::likely_sparse<TypeParam>({ 0, dense }));
+    EXPECT_FALSE(scalar_multiplication::classify_scalars<TypeParam>({ 0, dense }).is_sparse());
+
+    // A structured trace: blocks of full scalars separated by larger unused blocks
+    std::vector<Fr> blocks(size, Fr::zero());
+    for (size_t i = 0; i < size; i += 1024) {
+        for (size_t j = i; j < i + 256; ++j) {
+            blocks[j] = Fr::random_element(&engine);
+        }
+    }
+    EXPECT_TRUE(scalar_multiplication::likely_sparse<TypeParam>({ 0, blocks }));
+    EXPECT_TRUE(scalar_multiplication::classify_scalars<TypeParam>({ 0, blocks }).is_sparse());
+
+    // Too small to sample
+    EXPECT_TRUE(scalar_multiplication::likely_sparse<TypeParam>({ 0, std::span<const Fr>(dense).first(100) }));
+}
+
+TYPED_TEST(SparseMsmTests, MatchesNaiveMsm)
+{
+    using Fr = typename TestFixture::Fr;
+    using G1 = typename TestFixture::G1;
+
+    // A selector-like mix of zeros, ±1 and small values with a few full scalars, starting at an offset into the bases
+    const size_t start_index = 37;
+    std::vector<Fr> scalars(TestFixture::NUM_POINTS - start_index);
+    for (size_t i = 0; i < scalars.size(); ++i) {
+        switch (engine.get_random_uint8() % 6) {
+        case 0:
+            scalars[i] = Fr::one();
+            break;
+        case 1:
+            scalars[i] = -Fr::one();
+            break;
+        case 2:
+            scalars[i] = Fr(engine.get_random_uint64());
+            break;
+        case 3:
+            scalars[i] = -Fr(engine.get_random_uint64());
+            break;
+        case 4:
+            scalars[i] = Fr::random_element(&engine);
+            break;
+        default:
+            scalars[i] = Fr::zero();
+        }
+    }
+    PolynomialSpan<const Fr> span{ start_index, scalars };
+    auto classification = scalar_multiplication::classify_scalars<TypeParam>(span);
+    EXPECT_EQ(classification.num_zero + classification.num_unit + classification.num_small + classification.num_full,
+              scalars.size());
+
+    scalar_multiplication::pippenger_runtime_state<TypeParam> state(TestFixture::NUM_POINTS);
+    G1 result =
+        scalar_multiplication::sparse_msm_unsafe<TypeParam>(span, classification, this->get_point_table(), state);
+    EXPECT_EQ(result, this->naive_msm(span));
+
+    // All zero
+    std::vector<Fr> zeros(100, Fr::zero());
+    auto zero_classification = scalar_multiplication::classify_scalars<TypeParam>({ 0, zeros });
+    EXPECT_TRUE(zero_classification.is_sparse());
+    EXPECT_TRUE(scalar_multiplication::sparse_msm_unsafe<TypeParam>(
+                    { 0, zeros }, zero_classification, this->get_point_table(), state)
+                    .is_point_at_infinity());
+}
+
+} // namespace bb
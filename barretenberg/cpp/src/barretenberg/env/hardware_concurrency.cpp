@@ -6,9 +6,70 @@
 #include <string>
 
 #ifndef NO_MULTITHREADING
+#include <algorithm>
 #include <thread>
 #endif
 
+#if !defined(NO_MULTITHREADING) && defined(__linux__)
+#include <fstream>
+#include <sched.h>
+
+namespace {
+/**
+ * @brief The number of cpus the process may use as per its cgroup cpu quota (cgroup v2 cpu.max, else v1
+ * cpu.cfs_quota_us/cpu.cfs_period_us), rounded up; 0 if there is no quota.
+ * @details Containers are commonly given a quota rather than a cpuset, which hardware_concurrency does not see: using
+ * all the cores of the host then gets the process throttled.
+ */
+uint32_t cgroup_cpu_quota()
+{
+    std::string quota;
+    uint64_t period = 0;
+    std::ifstream cpu_max("/sys/fs/cgroup/cpu.max");
+    if (!(cpu_max >> quota >> period)) {
+        quota.clear();
+        period = 0;
+        std::ifstream cfs_quota("/sys/fs/cgroup/cpu/cpu.cfs_quota_us");
+        std::ifstream cfs_period("/sys/fs/cgroup/cpu/cpu.cfs_period_us");
+        cfs_quota >> quota;
+        cfs_period >> period;
+    }
+    if (quota.empty() || quota == "max" || quota[0] == '-' || period == 0) {
+        return 0;
+    }
+    try {
+        const uint64_t quota_us = std::stoull(quota);
+        return static_cast<uint32_t>(std::max<uint64_t>(1, (quota_us + period - 1) / period));
+    } catch (std::exception const&) {
+        return 0;
+    }
+}
+
+// The number of cpus in the affinity mask of the process (e.g. when run under taskset or in a cpuset)
+uint32_t affinity_cpu_count()
+{
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+        return 0;
+    }
+    return static_cast<uint32_t>(CPU_COUNT(&mask));
+}
+
+uint32_t available_cpus()
+{
+    uint32_t cores = std::thread::hardware_concurrency();
+    if (uint32_t affinity = affinity_cpu_count(); affinity != 0) {
+        cores = std::min(cores, affinity);
+    }
+    if (uint32_t quota = cgroup_cpu_quota(); quota != 0) {
+        cores = std::min(cores, quota);
+    }
+    return std::max<uint32_t>(cores, 1);
+}
+} // namespace
+#endif
+
 extern "C" {
 
 #ifdef NO_MULTITHREADING
@@ -23,7 +84,11 @@ uint32_t env_hardware_concurrency()
     try {
 #endif
         static auto val = std::getenv("HARDWARE_CONCURRENCY");
+#ifdef __linux__
+        static const uint32_t cores = val ? (uint32_t)std::stoul(val) : available_cpus();
+#else
         static const uint32_t cores = val ? (uint32_t)std::stoul(val) : std::thread::hardware_concurrency();
+#endif
         return cores;
 #ifndef __wasm__
     } catch (std::exception const&) {
@@ -0,0 +1,112 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Row ranges [start, end) of an execution trace, e.g. the rows over which its blocks are active
+ */
+using RowRanges = std::vector<std::pair<size_t, size_t>>;
+
+/**
+ * @brief Sort the ranges and merge the ones that overlap or touch, dropping empty ranges
+ */
+inline RowRanges normalize_row_ranges(RowRanges ranges)
+{
+    std::erase_if(ranges, [](const auto& range) { return range.first >= range.second; });
+    std::sort(ranges.begin(), ranges.end());
+    RowRanges result;
+    for (const auto& range : ranges) {
+        if (!result.empty() && range.first <= result.back().second) {
+            result.back().second = std::max(result.back().second, range.second);
+        } else {
+            result.push_back(range);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief The ranges of the next sumcheck round, whose row i is the partial evaluation of rows 2i and 2i + 1
+ */
+inline RowRanges fold_row_ranges(const RowRanges& ranges)
+{
+    RowRanges result;
+    result.reserve(ranges.size());
+    for (const auto& [start, end] : ranges) {
+        result.emplace_back(start >> 1, (end + 1) >> 1);
+    }
+    return normalize_row_ranges(std::move(result));
+}
+
+/**
+ * @brief The ranges of the edges (pairs of rows 2i, 2i + 1) touching the given rows, as ranges of rows clipped to
+ * round_size; each range starts and ends on an even row
+ */
+inline RowRanges row_ranges_to_edge_ranges(const RowRanges& ranges, size_t round_size)
+{
+    RowRanges result;
+    result.reserve(ranges.size());
+    for (const auto& [start, end] : ranges) {
+        result.emplace_back(start & ~static_cast<size_t>(1), std::min((end + 1) & ~static_cast<size_t>(1), round_size));
+    }
+    return normalize_row_ranges(std::move(result));
+}
+
+/**
+ * @brief The complement of the given normalized ranges within [0, size)
+ */
+inline RowRanges complement_row_ranges(const RowRanges& ranges, size_t size)
+{
+    RowRanges result;
+    size_t start = 0;
+    for (const auto& range : ranges) {
+        if (range.first >= size) {
+            break;
+        }
+        if (range.first > start) {
+            result.emplace_back(start, range.first);
+        }
+        start = std::max(start, range.second);
+    }
+    if (start < size) {
+        result.emplace_back(start, size);
+    }
+    return result;
+}
+
+/**
+ * @brief The rows [first, last) of the concatenation of the given ranges, as ranges of rows; e.g. used to split the
+ * active rows evenly across threads
+ */
+inline RowRanges slice_row_ranges(const RowRanges& ranges, size_t first, size_t last)
+{
+    RowRanges result;
+    size_t range_first = 0; // position of the first row of the current range in the concatenation
+    for (const auto& [start, end] : ranges) {
+        const size_t range_last = range_first + end - start;
+        if (first < last && first < range_last) {
+            result.emplace_back(start + first - range_first, start + std::min(last, range_last) - range_first);
+            first = std::min(last, range_last);
+        }
+        range_first = range_last;
+    }
+    return result;
+}
+
+/**
+ * @brief The total number of rows in the ranges
+ */
+inline size_t count_rows(const RowRanges& ranges)
+{
+    size_t num_rows = 0;
+    for (const auto& [start, end] : ranges) {
+        num_rows += end - start;
+    }
+    return num_rows;
+}
+
+} // namespace bb
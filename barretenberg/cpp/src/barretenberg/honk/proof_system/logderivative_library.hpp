@@ -1,4 +1,9 @@
 #pragma once
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include "barretenberg/polynomials/polynomial_at_row.hpp"
+#include <algorithm>
 #include <typeinfo>
 
 namespace bb {
@@ -27,34 +32,52 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
 {
     using FF = typename Flavor::FF;
     using Accumulator = typename Relation::ValueAccumulator0;
+    using RowView = typename Flavor::template AllEntities<PolynomialAtRow<FF>>;
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
+    // Below this many rows, a lookup is not worth spreading over threads
+    constexpr size_t MIN_ROWS_PER_THREAD = 1 << 10;
 
     auto& inverse_polynomial = Relation::template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): avoid get_row if possible.
-        auto row = polynomials.get_row(i);
-        bool has_inverse = Relation::operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
-        }
-        FF denominator = 1;
-        bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                Relation::template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial.at(i) = denominator;
-    };
-
-    // Compute inverse polynomial I in place by inverting the product at each row
-    // Note: zeroes are ignored as they are not used anyway
-    FF::batch_invert(inverse_polynomial.coeffs());
+    // The inverse can only be nonzero where the inverse polynomial is backed by memory
+    const size_t start = inverse_polynomial.start_index();
+    const size_t end = std::min(circuit_size, inverse_polynomial.end_index());
+    if (start >= end) {
+        return;
+    }
+
+    parallel_for_range(
+        end - start,
+        [&](size_t chunk_start, size_t chunk_end) {
+            size_t row_idx = 0;
+            RowView row;
+            for (auto [column, polynomial] : zip_view(row.get_all(), polynomials.get_all())) {
+                column = PolynomialAtRow<FF>(polynomial, row_idx);
+            }
+            for (row_idx = start + chunk_start; row_idx < start + chunk_end; ++row_idx) {
+                // Only reads the selectors of the relation, which are zero on most rows
+                bool has_inverse = Relation::operation_exists_at_row(row);
+                if (!has_inverse) {
+                    continue;
+                }
+                FF denominator = 1;
+                bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+                    auto denominator_term =
+                        Relation::template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+                    auto denominator_term =
+                        Relation::template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                inverse_polynomial.at(row_idx) = denominator;
+            }
+            // Compute inverse polynomial I in place by inverting the product at each row of the chunk
+            // Note: zeroes are ignored as they are not used anyway
+            FF::batch_invert(inverse_polynomial.coeffs().subspan(chunk_start, chunk_end - chunk_start));
+        },
+        MIN_ROWS_PER_THREAD);
 }
 
 /**
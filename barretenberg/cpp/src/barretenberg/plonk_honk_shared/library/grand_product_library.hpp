@@ -3,7 +3,9 @@
 #include "barretenberg/common/debug_log.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/honk/proof_system/active_ranges.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
+#include "barretenberg/polynomials/polynomial_at_row.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include <typeinfo>
 
@@ -33,122 +35,143 @@ namespace bb {
  *
  * For Flavor::Ultra both the UltraPermutation and Lookup grand products are computed by this method.
  *
- * The grand product is constructed over the course of three steps.
- *
  * For expositional simplicity, write Z_perm[i] as
  *
  *                A(j)
  * Z_perm[i] = ∏ --------------------------
  *                B(h)
  *
- * Step 1) Compute 2 length-n polynomials A, B
- * Step 2) Compute 2 length-n polynomials numerator = ∏ A(j), nenominator = ∏ B(j)
- * Step 3) Compute Z_perm[i + 1] = numerator[i] / denominator[i] (recall: Z_perm[0] = 1)
+ * The active rows are split evenly across threads and the grand product is constructed in two passes over them.
+ *
+ * Step 1) Each thread walks its rows in tiles, evaluating A(j), B(j) on the fly and accumulating the running products
+ * ∏ A(j), ∏ B(j) over its rows. At the end of each tile, the running denominators of the tile are inverted with a
+ * single Montgomery batch inversion and Z_perm is set to the thread-local ratio ∏ A(j) / ∏ B(j).
+ * Step 2) A scan over the per-thread products gives each thread the ratio accumulated by the threads before it, by
+ * which the thread scales its values of Z_perm.
  *
- * Note: Step (3) utilizes Montgomery batch inversion to replace n-many inversions with
+ * Rows outside of the active ranges must have A(j) = B(j), as is the case for the rows of a structured trace that lie
+ * between blocks (their wires vanish and σ = id there). Z_perm is constant over those rows and is simply filled in.
+ *
+ * @param active_ranges The ranges of rows where A(j) may differ from B(j); empty if all rows may
  */
 template <typename Flavor, typename GrandProdRelation>
 void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
-                           bb::RelationParameters<typename Flavor::FF>& relation_parameters)
+                           bb::RelationParameters<typename Flavor::FF>& relation_parameters,
+                           const RowRanges& active_ranges = {})
 {
     using FF = typename Flavor::FF;
-    using Polynomial = typename Flavor::Polynomial;
     using Accumulator = std::tuple_element_t<0, typename GrandProdRelation::SumcheckArrayOfValuesOverSubrelations>;
+    using RowView = typename Flavor::template AllEntities<PolynomialAtRow<FF>>;
+    // Rows per batch inversion, so that the running denominators of a tile stay in cache
+    constexpr size_t TILE_SIZE = 1 << 12;
 
-    // Allocate numerator/denominator polynomials that will serve as scratch space
-    // TODO(zac) we can re-use the permutation polynomial as the numerator polynomial. Reduces readability
     size_t circuit_size = full_polynomials.get_polynomial_size();
-    Polynomial numerator{ circuit_size, circuit_size };
-    Polynomial denominator{ circuit_size, circuit_size };
+    auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
+    // We have a 'virtual' 0 at the start (as this is a to-be-shifted polynomial)
+    ASSERT(grand_product_polynomial.start_index() == 1);
+
+    // Z_perm[i + 1] is determined by the rows j <= i, for i < n - 1
+    const size_t num_rows = circuit_size - 1;
+    RowRanges ranges;
+    if (active_ranges.empty()) {
+        ranges.emplace_back(0, num_rows);
+    } else {
+        for (const auto& [start, end] : active_ranges) {
+            ranges.emplace_back(std::min(start, num_rows), std::min(end, num_rows));
+        }
+        ranges = normalize_row_ranges(std::move(ranges));
+    }
+    const size_t num_active_rows = count_rows(ranges);
+    const size_t num_threads = std::max(calculate_num_threads(num_active_rows), static_cast<size_t>(1));
 
     // Step (1)
-    // Populate `numerator` and `denominator` with the algebra described by Relation
-    const size_t num_threads = circuit_size >= get_num_cpus_pow2() ? get_num_cpus_pow2() : 1;
-    const size_t block_size = circuit_size / num_threads;
+    std::vector<FF> partial_numerators(num_threads, FF::one());
+    std::vector<FF> partial_denominators(num_threads, FF::one());
     parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        typename Flavor::AllValues evaluations;
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/940): construction of evaluations is equivalent to
-        // calling get_row which creates full copies. avoid?
-        for (size_t i = start; i < end; ++i) {
-            for (auto [eval, full_poly] : zip_view(evaluations.get_all(), full_polynomials.get_all())) {
-                eval = full_poly.size() > i ? full_poly[i] : 0;
-            }
-            numerator.at(i) = GrandProdRelation::template compute_grand_product_numerator<Accumulator>(
-                evaluations, relation_parameters);
-            denominator.at(i) = GrandProdRelation::template compute_grand_product_denominator<Accumulator>(
-                evaluations, relation_parameters);
+        size_t row = 0;
+        RowView row_view;
+        for (auto [view, polynomial] : zip_view(row_view.get_all(), full_polynomials.get_all())) {
+            view = PolynomialAtRow<FF>(polynomial, row);
         }
-    });
-
-    DEBUG_LOG_ALL(numerator.coeffs());
-    DEBUG_LOG_ALL(denominator.coeffs());
 
-    // Step (2)
-    // Compute the accumulating product of the numerator and denominator terms.
-    // This step is split into three parts for efficient multithreading:
-    // (i) compute ∏ A(j), ∏ B(j) subproducts for each thread
-    // (ii) compute scaling factor required to convert each subproduct into a single running product
-    // (ii) combine subproducts into a single running product
-    //
-    // For example, consider 4 threads and a size-8 numerator { a0, a1, a2, a3, a4, a5, a6, a7 }
-    // (i)   Each thread computes 1 element of N = {{ a0, a0a1 }, { a2, a2a3 }, { a4, a4a5 }, { a6, a6a7 }}
-    // (ii)  Take partial products P = { 1, a0a1, a2a3, a4a5 }
-    // (iii) Each thread j computes N[i][j]*P[j]=
-    //      {{a0,a0a1},{a0a1a2,a0a1a2a3},{a0a1a2a3a4,a0a1a2a3a4a5},{a0a1a2a3a4a5a6,a0a1a2a3a4a5a6a7}}
-    std::vector<FF> partial_numerators(num_threads);
-    std::vector<FF> partial_denominators(num_threads);
-
-    parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end - 1; ++i) {
-            numerator.at(i + 1) *= numerator[i];
-            denominator.at(i + 1) *= denominator[i];
+        FF numerator = FF::one();
+        FF denominator = FF::one();
+        std::vector<FF> tile_denominators(TILE_SIZE);
+        const RowRanges thread_ranges = slice_row_ranges(
+            ranges, thread_idx * num_active_rows / num_threads, (thread_idx + 1) * num_active_rows / num_threads);
+        for (const auto& [start, end] : thread_ranges) {
+            for (size_t tile_start = start; tile_start < end; tile_start += TILE_SIZE) {
+                const size_t tile_end = std::min(tile_start + TILE_SIZE, end);
+                for (row = tile_start; row < tile_end; ++row) {
+                    numerator *= GrandProdRelation::template compute_grand_product_numerator<Accumulator>(
+                        row_view, relation_parameters);
+                    denominator *= GrandProdRelation::template compute_grand_product_denominator<Accumulator>(
+                        row_view, relation_parameters);
+                    grand_product_polynomial.at(row + 1) = numerator;
+                    tile_denominators[row - tile_start] = denominator;
+                }
+                FF::batch_invert(std::span{ tile_denominators.data(), tile_end - tile_start });
+                for (size_t i = tile_start; i < tile_end; ++i) {
+                    grand_product_polynomial.at(i + 1) *= tile_denominators[i - tile_start];
+                }
+            }
         }
-        partial_numerators[thread_idx] = numerator[end - 1];
-        partial_denominators[thread_idx] = denominator[end - 1];
+        partial_numerators[thread_idx] = numerator;
+        partial_denominators[thread_idx] = denominator;
     });
 
     DEBUG_LOG_ALL(partial_numerators);
     DEBUG_LOG_ALL(partial_denominators);
 
+    // Step (2)
+    // The scaling of thread j is ∏_{k < j} partial_numerators[k] / partial_denominators[k]
+    std::vector<FF> numerator_scalings(num_threads);
+    std::vector<FF> denominator_scalings(num_threads);
+    numerator_scalings[0] = FF::one();
+    denominator_scalings[0] = FF::one();
+    for (size_t thread_idx = 1; thread_idx < num_threads; ++thread_idx) {
+        numerator_scalings[thread_idx] = numerator_scalings[thread_idx - 1] * partial_numerators[thread_idx - 1];
+        denominator_scalings[thread_idx] = denominator_scalings[thread_idx - 1] * partial_denominators[thread_idx - 1];
+    }
+    FF::batch_invert(denominator_scalings);
     parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        if (thread_idx > 0) {
-            FF numerator_scaling = 1;
-            FF denominator_scaling = 1;
-
-            for (size_t j = 0; j < thread_idx; ++j) {
-                numerator_scaling *= partial_numerators[j];
-                denominator_scaling *= partial_denominators[j];
-            }
+        if (thread_idx == 0) {
+            return;
+        }
+        const FF scaling = numerator_scalings[thread_idx] * denominator_scalings[thread_idx];
+        const RowRanges thread_ranges = slice_row_ranges(
+            ranges, thread_idx * num_active_rows / num_threads, (thread_idx + 1) * num_active_rows / num_threads);
+        for (const auto& [start, end] : thread_ranges) {
             for (size_t i = start; i < end; ++i) {
-                numerator.at(i) = numerator[i] * numerator_scaling;
-                denominator.at(i) = denominator[i] * denominator_scaling;
+                grand_product_polynomial.at(i + 1) *= scaling;
             }
         }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator.data()[start], block_size });
     });
 
-    DEBUG_LOG_ALL(numerator.coeffs());
-    DEBUG_LOG_ALL(denominator.coeffs());
-
-    // Step (3) Compute z_perm[i] = numerator[i] / denominator[i]
-    auto& grand_product_polynomial = GrandProdRelation::get_grand_product_polynomial(full_polynomials);
-    // We have a 'virtual' 0 at the start (as this is a to-be-shifted polynomial)
-    ASSERT(grand_product_polynomial.start_index() == 1);
-    parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx == num_threads - 1) ? circuit_size - 1 : (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end; ++i) {
-            grand_product_polynomial.at(i + 1) = numerator[i] * denominator[i];
+    // Fill in the constant values of Z_perm over the inactive rows
+    const RowRanges gaps = complement_row_ranges(ranges, num_rows);
+    if (!gaps.empty()) {
+        std::vector<FF> gap_values(gaps.size());
+        for (size_t gap_idx = 0; gap_idx < gaps.size(); ++gap_idx) {
+            const size_t gap_start = gaps[gap_idx].first;
+            gap_values[gap_idx] = gap_start == 0 ? FF::one() : grand_product_polynomial[gap_start];
         }
-    });
+        const size_t num_gap_rows = count_rows(gaps);
+        const size_t num_fill_threads = calculate_num_threads(num_gap_rows);
+        parallel_for(num_fill_threads, [&](size_t thread_idx) {
+            const RowRanges thread_gaps = slice_row_ranges(gaps,
+                                                           thread_idx * num_gap_rows / num_fill_threads,
+                                                           (thread_idx + 1) * num_gap_rows / num_fill_threads);
+            for (const auto& [start, end] : thread_gaps) {
+                // The gap containing this slice is the last one starting at or before it
+                const auto gap_it = std::upper_bound(gaps.begin(), gaps.end(), std::make_pair(start, num_rows));
+                const FF& value = gap_values[static_cast<size_t>(std::distance(gaps.begin(), gap_it)) - 1];
+                for (size_t i = start; i < end; ++i) {
+                    grand_product_polynomial.at(i + 1) = value;
+                }
+            }
+        });
+    }
 
     DEBUG_LOG_ALL(grand_product_polynomial.coeffs());
 }
@@ -159,7 +182,8 @@ void compute_grand_product(typename Flavor::ProverPolynomials& full_polynomials,
  */
 template <typename Flavor>
 void compute_grand_products(typename Flavor::ProverPolynomials& full_polynomials,
-                            bb::RelationParameters<typename Flavor::FF>& relation_parameters)
+                            bb::RelationParameters<typename Flavor::FF>& relation_parameters,
+                            const RowRanges& active_ranges = {})
 {
     using GrandProductRelations = typename Flavor::GrandProductRelations;
 
@@ -167,7 +191,7 @@ void compute_grand_products(typename Flavor::ProverPolynomials& full_polynomials
     bb::constexpr_for<0, NUM_RELATIONS, 1>([&]<size_t i>() {
         using GrandProdRelation = typename std::tuple_element<i, GrandProductRelations>::type;
 
-        compute_grand_product<Flavor, GrandProdRelation>(full_polynomials, relation_parameters);
+        compute_grand_product<Flavor, GrandProdRelation>(full_polynomials, relation_parameters, active_ranges);
     });
 }
 
@@ -5,6 +5,7 @@
 #include "barretenberg/stdlib/primitives/bool/bool.hpp"
 
 #include <cstddef>
+#include <span>
 #include <vector>
 namespace bb {
 
@@ -145,33 +146,31 @@ template <typename FF> struct GateSeparatorPolynomial {
         size_t pow_size = 1 << log_num_monomials;
         std::vector<FF> beta_products(pow_size);
 
-        // Determine number of threads for multithreading.
-        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
-        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
-        size_t max_num_threads = get_num_cpus_pow2(); // number of available threads (power of 2)
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t desired_num_threads = pow_size / min_iterations_per_thread;
-        size_t num_threads = std::min(desired_num_threads, max_num_threads); // fewer than max if justified
-        num_threads = num_threads > 0 ? num_threads : 1;                     // ensure num threads is >= 1
-        size_t iterations_per_thread = pow_size / num_threads;               // actual iterations per thread
-
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/864): This computation is asymtotically slow as it
-        // does pow_size * log(pow_size) work. However, in practice, its super efficient because its trivially
-        // parallelizable and only takes 45ms for the whole 6 iter IVC benchmark. Its also very readable, so we're
-        // leaving it unoptimized for now.
-        parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-            for (size_t i = start; i < end; i++) {
-                auto res = FF(1);
-                for (size_t j = i, beta_idx = 0; j > 0; j >>= 1, beta_idx++) {
-                    if ((j & 1) == 1) {
-                        res *= betas[beta_idx];
-                    }
-                }
-                beta_products[i] = res;
+        // Split the bits of \ell into a low half and a high half, so that
+        //      pow_{\ell}(\vec \beta) = pow_{\ell_{lo}}(\beta_0, ..) * pow_{\ell_{hi}}(\beta_{lo_bits}, ..).
+        // Both half tables are small (~sqrt(pow_size)) and are expanded one variable at a time by doubling. Every block
+        // of the output is then the low table scaled by a single element of the high table, which is a batched
+        // multiplication by a scalar (see field::mul_batch). This is pow_size multiplications in total.
+        const size_t log_low_size = (log_num_monomials + 1) / 2;
+        const auto expand = [&](const size_t first_beta_idx, const size_t num_betas) {
+            std::vector<FF> table(1UL << num_betas);
+            table[0] = FF(1);
+            for (size_t k = 0; k < num_betas; k++) {
+                const size_t half = 1UL << k;
+                FF::mul_batch(std::span<const FF>{ table.data(), half },
+                              betas[first_beta_idx + k],
+                              std::span<FF>{ table.data() + half, half });
             }
+            return table;
+        };
+        const std::vector<FF> low_products = expand(0, log_low_size);
+        const std::vector<FF> high_products = expand(log_low_size, log_num_monomials - log_low_size);
+        const size_t block_size = low_products.size();
+
+        parallel_for(high_products.size(), [&](size_t block_idx) {
+            FF::mul_batch(low_products,
+                          high_products[block_idx],
+                          std::span<FF>{ beta_products.data() + block_idx * block_size, block_size });
         });
 
         return beta_products;
@@ -6,7 +6,10 @@
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
 #include "polynomial_arithmetic.hpp"
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <fcntl.h>
 #include <list>
 #include <memory>
@@ -18,6 +21,34 @@
 
 namespace bb {
 
+namespace {
+// Below this many bytes, initialising memory in parallel is not worth a parallel_for
+constexpr size_t PARALLEL_INITIALIZATION_MIN_BYTES = 1UL << 22;
+
+/**
+ * @brief Copy num_bytes from src to dst, or zero them if src is null, in parallel for large sizes
+ * @details Pages are placed on the NUMA node of the thread that first touches them: initialising freshly allocated
+ * memory from the thread pool spreads it over the nodes, rather than putting a whole polynomial on the node of the
+ * allocating thread (see common/numa.hpp).
+ */
+void initialize_memory(void* dst, const void* src, size_t num_bytes)
+{
+    auto initialize_range = [&](size_t start, size_t end) {
+        if (src == nullptr) {
+            memset(static_cast<uint8_t*>(dst) + start, 0, end - start);
+        } else {
+            memcpy(static_cast<uint8_t*>(dst) + start, static_cast<const uint8_t*>(src) + start, end - start);
+        }
+    };
+#ifdef __wasm__
+    // No NUMA, and the wasm thread pool does not allow nested parallel_for calls
+    initialize_range(0, num_bytes);
+#else
+    parallel_for_range(num_bytes, initialize_range, PARALLEL_INITIALIZATION_MIN_BYTES);
+#endif
+}
+} // namespace
+
 // Note: This function is pretty gnarly, but we try to make it the only function that deals
 // with copying polynomials. It should be scrutinized thusly.
 template <typename Fr>
@@ -31,11 +62,12 @@ SharedShiftedVirtualZeroesArray<Fr> _clone(const SharedShiftedVirtualZeroesArray
     // zero any left extensions to the array
     memset(static_cast<void*>(backing_clone.get()), 0, sizeof(Fr) * left_expansion);
     // copy our cloned array over
-    memcpy(static_cast<void*>(backing_clone.get() + left_expansion),
-           static_cast<const void*>(array.backing_memory_.get()),
-           sizeof(Fr) * array.size());
+    initialize_memory(static_cast<void*>(backing_clone.get() + left_expansion),
+                      static_cast<const void*>(array.backing_memory_.get()),
+                      sizeof(Fr) * array.size());
     // zero any right extensions to the array
-    memset(static_cast<void*>(backing_clone.get() + left_expansion + array.size()), 0, sizeof(Fr) * right_expansion);
+    initialize_memory(
+        static_cast<void*>(backing_clone.get() + left_expansion + array.size()), nullptr, sizeof(Fr) * right_expansion);
     return { array.start_ - left_expansion, array.end_ + right_expansion, array.virtual_size_, backing_clone };
 }
 
@@ -63,7 +95,7 @@ void Polynomial<Fr>::allocate_backing_memory(size_t size, size_t virtual_size, s
 template <typename Fr> Polynomial<Fr>::Polynomial(size_t size, size_t virtual_size, size_t start_index)
 {
     allocate_backing_memory(size, virtual_size, start_index);
-    memset(static_cast<void*>(coefficients_.backing_memory_.get()), 0, sizeof(Fr) * size);
+    initialize_memory(static_cast<void*>(coefficients_.backing_memory_.get()), nullptr, sizeof(Fr) * size);
 }
 
 /**
@@ -108,7 +140,8 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
 {
     allocate_backing_memory(coefficients.size(), virtual_size, 0);
 
-    memcpy(static_cast<void*>(data()), static_cast<const void*>(coefficients.data()), sizeof(Fr) * coefficients.size());
+    initialize_memory(
+        static_cast<void*>(data()), static_cast<const void*>(coefficients.data()), sizeof(Fr) * coefficients.size());
 }
 
 // Assignments
@@ -130,6 +163,18 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::share() const
     return p;
 }
 
+template <typename Fr> Polynomial<Fr> Polynomial<Fr>::share_range(size_t start, size_t size) const
+{
+    ASSERT(start >= start_index() && start + size <= end_index());
+    // Alias the backing memory, so that it lives as long as any of the polynomials sharing it
+    const auto& memory = coefficients_.backing_memory_;
+    Polynomial p;
+    p.coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{
+        0, size, size, std::shared_ptr<Fr[]>(memory, memory.get() + (start - start_index()))
+    };
+    return p;
+}
+
 template <typename Fr> bool Polynomial<Fr>::operator==(Polynomial const& rhs) const
 {
     // If either is empty, both must be
@@ -308,8 +353,17 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(PolynomialSpan<const Fr>
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread + other.start_index;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) += scaling_factor * other[i];
+        // Scale a tile at a time so that the multiplications go through the batched (possibly SIMD) field kernel
+        constexpr size_t TILE_SIZE = 64;
+        std::array<Fr, TILE_SIZE> scaled;
+        for (size_t i = offset; i < end; i += TILE_SIZE) {
+            const size_t tile_size = std::min(TILE_SIZE, end - i);
+            Fr::mul_batch(other.span.subspan(i - other.start_index, tile_size),
+                          scaling_factor,
+                          std::span<Fr>{ scaled.data(), tile_size });
+            for (size_t k = 0; k < tile_size; ++k) {
+                at(i + k) += scaled[k];
+            }
         }
     });
 }
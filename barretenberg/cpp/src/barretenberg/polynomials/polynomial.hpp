@@ -5,6 +5,7 @@
 #include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/plonk_honk_shared/types/circuit_type.hpp"
+#include "barretenberg/polynomials/polynomial_arena.hpp"
 #include "barretenberg/polynomials/shared_shifted_virtual_zeroes_array.hpp"
 #include "evaluation_domain.hpp"
 #include "polynomial_arithmetic.hpp"
@@ -123,6 +124,12 @@ template <typename Fr> class Polynomial {
      */
     Polynomial share() const;
 
+    /**
+     * @brief A polynomial of size `size` whose coefficients are the coefficients [start, start + size) of this one,
+     * sharing its memory. Lets disjoint polynomials live in one allocation.
+     */
+    Polynomial share_range(size_t start, size_t size) const;
+
     void clear() { coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{}; }
 
     /**
@@ -394,7 +401,7 @@ template <typename Fr> class Polynomial {
 template <typename Fr> std::shared_ptr<Fr[]> _allocate_aligned_memory(size_t n_elements)
 {
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
-    return std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * n_elements));
+    return std::static_pointer_cast<Fr[]>(allocate_polynomial_memory(sizeof(Fr) * n_elements));
 }
 
 /**
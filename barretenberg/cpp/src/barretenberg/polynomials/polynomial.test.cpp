@@ -67,6 +67,34 @@ TEST(Polynomial, Indices)
     EXPECT_EQ(std::get<1>(*poly.indexed_values().begin()), poly[poly.start_index()]);
 }
 
+// Large polynomials are zeroed and copied in parallel chunks
+TEST(Polynomial, LargeInitialization)
+{
+    using FF = bb::fr;
+    using Polynomial = bb::Polynomial<FF>;
+    const size_t SIZE = (1 << 18) + 3;
+    Polynomial zeroes(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        ASSERT_TRUE(zeroes[i].is_zero());
+    }
+
+    Polynomial poly(SIZE, SIZE + 100);
+    for (size_t i = 0; i < SIZE; ++i) {
+        poly.at(i) = FF::random_element();
+    }
+    Polynomial copy(poly);
+    Polynomial expanded(poly, SIZE + 100);
+    Polynomial from_span(poly.coeffs());
+    for (size_t i = 0; i < SIZE; ++i) {
+        ASSERT_EQ(copy[i], poly[i]);
+        ASSERT_EQ(expanded[i], poly[i]);
+        ASSERT_EQ(from_span[i], poly[i]);
+    }
+    for (size_t i = SIZE; i < SIZE + 100; ++i) {
+        ASSERT_TRUE(expanded[i].is_zero());
+    }
+}
+
 #ifndef NDEBUG
 // Only run in an assert-enabled test suite.
 TEST(Polynomial, AddScaledEdgeConditions)
@@ -202,4 +230,28 @@ TEST(Polynomial, Expand)
     ASSERT_DEATH(test_subset_bad3(), ".*new_end_index.*end_index.*");
 }
 
-#endif
\ No newline at end of file
+#endif
+// Polynomials sharing ranges of one allocation see each other's writes and keep the memory alive
+TEST(Polynomial, ShareRange)
+{
+    using FF = bb::fr;
+    using Polynomial = bb::Polynomial<FF>;
+    Polynomial first;
+    Polynomial second;
+    {
+        Polynomial buffer(8, 10, 2);
+        first = buffer.share_range(2, 4);
+        second = buffer.share_range(6, 4);
+        buffer.at(7) = FF(7);
+    }
+    EXPECT_EQ(first.start_index(), 0);
+    EXPECT_EQ(first.size(), 4);
+    EXPECT_EQ(first.virtual_size(), 4);
+    EXPECT_EQ(second[1], FF(7));
+
+    first.at(3) = FF(3);
+    second.at(0) = FF(4);
+    EXPECT_EQ(first[3], FF(3));
+    EXPECT_EQ(second[0], FF(4));
+    EXPECT_EQ(second[1], FF(7));
+}
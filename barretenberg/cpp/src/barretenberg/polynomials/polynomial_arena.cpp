@@ -0,0 +1,259 @@
+#include "polynomial_arena.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+#ifndef __wasm__
+#include <unistd.h>
+#endif
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace bb {
+
+namespace {
+std::shared_ptr<PolynomialArena> make_default_arena()
+{
+    const char* env = std::getenv("BB_HUGEPAGE_ARENA");
+    if (env != nullptr && std::string(env) == "1") {
+        return std::make_shared<HugePageArena>();
+    }
+    return nullptr;
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::shared_ptr<PolynomialArena> polynomial_arena = make_default_arena();
+#ifndef NO_MULTITHREADING
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex polynomial_arena_mutex;
+#endif
+
+void unmap(void* ptr, [[maybe_unused]] size_t size)
+{
+#ifdef __linux__
+    munmap(ptr, size);
+#else
+    aligned_free(ptr);
+#endif
+}
+} // namespace
+
+HugePageArena::~HugePageArena()
+{
+    trim();
+}
+
+std::shared_ptr<void> HugePageArena::allocate(size_t size)
+{
+    if (size < MIN_ARENA_ALLOCATION) {
+        return get_mem_slab(size);
+    }
+    const size_t rounded_size = (size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    void* ptr = nullptr;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        stats.num_allocations++;
+        auto it = free_buffers.find(rounded_size);
+        if (it != free_buffers.end()) {
+            ptr = it->second.back()->second;
+            cached_buffers.erase(it->second.back());
+            it->second.pop_back();
+            if (it->second.empty()) {
+                free_buffers.erase(it);
+            }
+            stats.num_reused++;
+            stats.cached_bytes -= rounded_size;
+        }
+    }
+    if (ptr == nullptr) {
+        ptr = map(rounded_size);
+    }
+    return { ptr, [arena = shared_from_this(), rounded_size](void* p) { arena->release(p, rounded_size); } };
+}
+
+void* HugePageArena::map(size_t size)
+{
+    void* ptr = nullptr;
+    bool hugetlb = false;
+#ifdef __linux__
+    bool try_hugetlb = false;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        try_hugetlb = hugetlb_available;
+    }
+    if (try_hugetlb) {
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr == MAP_FAILED) {
+            // Typically no huge pages are reserved (vm.nr_hugepages): don't retry for every allocation
+            ptr = nullptr;
+#ifndef NO_MULTITHREADING
+            std::unique_lock<std::mutex> lock(mutex);
+#endif
+            hugetlb_available = false;
+        } else {
+            hugetlb = true;
+        }
+    }
+    if (ptr == nullptr) {
+        // Transparent huge pages only back 2 MiB aligned ranges: over-map and trim to an aligned range
+        void* mapping =
+            mmap(nullptr, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) {
+            throw_or_abort("HugePageArena: failed to map " + std::to_string(size) + " bytes");
+        }
+        const auto address = reinterpret_cast<uintptr_t>(mapping);
+        const uintptr_t aligned = (address + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        if (aligned > address) {
+            munmap(mapping, aligned - address);
+        }
+        if (const size_t tail = HUGE_PAGE_SIZE - (aligned - address); tail > 0) {
+            munmap(reinterpret_cast<void*>(aligned + size), tail);
+        }
+        ptr = reinterpret_cast<void*>(aligned);
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#else
+    ptr = aligned_alloc(HUGE_PAGE_SIZE, size);
+#endif
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(mutex);
+#endif
+    stats.num_hugetlb_mappings += hugetlb ? 1 : 0;
+    stats.mapped_bytes += size;
+    stats.peak_mapped_bytes = std::max(stats.peak_mapped_bytes, stats.mapped_bytes);
+    return ptr;
+}
+
+void HugePageArena::release(void* ptr, size_t size)
+{
+    std::vector<std::pair<size_t, void*>> evicted;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        if (size > max_cached_bytes) {
+            evicted.emplace_back(size, ptr);
+        } else {
+            cached_buffers.emplace_front(size, ptr);
+            free_buffers[size].push_back(cached_buffers.begin());
+            stats.cached_bytes += size;
+        }
+        // Make room by unmapping the buffers released longest ago, which are first in their size's free list
+        while (stats.cached_bytes > max_cached_bytes) {
+            const auto [oldest_size, oldest_ptr] = cached_buffers.back();
+            auto it = free_buffers.find(oldest_size);
+            it->second.erase(it->second.begin());
+            if (it->second.empty()) {
+                free_buffers.erase(it);
+            }
+            cached_buffers.pop_back();
+            stats.cached_bytes -= oldest_size;
+            stats.num_evictions++;
+            evicted.emplace_back(oldest_size, oldest_ptr);
+        }
+        for (const auto& buffer : evicted) {
+            stats.mapped_bytes -= buffer.first;
+        }
+    }
+    for (const auto& [evicted_size, evicted_ptr] : evicted) {
+        unmap(evicted_ptr, evicted_size);
+    }
+}
+
+void HugePageArena::trim()
+{
+    CachedBuffers buffers;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        buffers.swap(cached_buffers);
+        free_buffers.clear();
+        stats.mapped_bytes -= stats.cached_bytes;
+        stats.cached_bytes = 0;
+    }
+    for (const auto& [size, ptr] : buffers) {
+        unmap(ptr, size);
+    }
+}
+
+size_t HugePageArena::default_max_cached_bytes()
+{
+#ifndef __wasm__
+    const long num_pages = sysconf(_SC_PHYS_PAGES);
+    const long page_size = sysconf(_SC_PAGESIZE);
+    if (num_pages > 0 && page_size > 0) {
+        return static_cast<size_t>(num_pages) * static_cast<size_t>(page_size) / 4;
+    }
+#endif
+    return FALLBACK_MAX_CACHED_BYTES;
+}
+
+PolynomialArenaStats HugePageArena::get_stats()
+{
+    PolynomialArenaStats result;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        result = stats;
+    }
+    result.peak_rss_bytes = get_peak_rss_bytes();
+    return result;
+}
+
+void set_polynomial_arena(std::shared_ptr<PolynomialArena> arena)
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(polynomial_arena_mutex);
+#endif
+    polynomial_arena = std::move(arena);
+}
+
+std::shared_ptr<PolynomialArena> get_polynomial_arena()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(polynomial_arena_mutex);
+#endif
+    return polynomial_arena;
+}
+
+std::shared_ptr<void> allocate_polynomial_memory(size_t size)
+{
+    if (auto arena = get_polynomial_arena()) {
+        return arena->allocate(size);
+    }
+    return get_mem_slab(size);
+}
+
+size_t get_peak_rss_bytes()
+{
+#if defined(__linux__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    // In KiB on Linux
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+} // namespace bb
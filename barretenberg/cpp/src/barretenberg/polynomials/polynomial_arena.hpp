@@ -0,0 +1,132 @@
+#pragma once
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#ifndef NO_MULTITHREADING
+#include <mutex>
+#endif
+
+namespace bb {
+
+/**
+ * @brief Source of the backing memory of polynomials (see _allocate_aligned_memory)
+ *
+ * @details By default polynomial memory comes from the slab allocator (get_mem_slab). An arena installed with
+ * set_polynomial_arena serves all polynomial allocations from then on; memory handed out earlier is still released to
+ * where it came from.
+ */
+class PolynomialArena {
+  public:
+    PolynomialArena() = default;
+    PolynomialArena(const PolynomialArena& other) = delete;
+    PolynomialArena(PolynomialArena&& other) = delete;
+    PolynomialArena& operator=(const PolynomialArena& other) = delete;
+    PolynomialArena& operator=(PolynomialArena&& other) = delete;
+    virtual ~PolynomialArena() = default;
+
+    /**
+     * @brief Memory for size bytes, at least 32 byte aligned, released when the last reference goes away
+     */
+    virtual std::shared_ptr<void> allocate(size_t size) = 0;
+};
+
+struct PolynomialArenaStats {
+    size_t num_allocations = 0;
+    // Allocations served from a cached buffer
+    size_t num_reused = 0;
+    // Buffers mapped with MAP_HUGETLB rather than with transparent huge pages advice
+    size_t num_hugetlb_mappings = 0;
+    // Memory mapped by the arena, whether in use or cached
+    size_t mapped_bytes = 0;
+    size_t peak_mapped_bytes = 0;
+    size_t cached_bytes = 0;
+    // Cached buffers unmapped to keep the cache within its limit
+    size_t num_evictions = 0;
+    // Peak resident set size of the process
+    size_t peak_rss_bytes = 0;
+};
+
+/**
+ * @brief Arena mapping large polynomials on huge pages, and keeping released buffers for reuse
+ *
+ * @details A proving key holds hundreds of polynomials of a handful of sizes, each spanning many 4 KiB pages. Buffers
+ * of at least MIN_ARENA_ALLOCATION bytes are mapped in multiples of 2 MiB, with MAP_HUGETLB if huge pages are reserved
+ * on the system and otherwise with madvise(MADV_HUGEPAGE), which cuts TLB misses. Released buffers are kept in per-size
+ * free lists and handed out again for requests of the same rounded size, so once the sizes of a proof have been seen,
+ * the following proofs of a long-running process neither map memory nor page fault. The cached buffers are limited to
+ * max_cached_bytes, by default a quarter of the physical memory: past it the buffers released longest ago are
+ * unmapped, so the sizes of earlier, different circuits do not pin memory forever. Smaller allocations go to the slab
+ * allocator.
+ *
+ * The arena lives as long as any of its buffers; it must be owned by a std::shared_ptr.
+ */
+class HugePageArena : public PolynomialArena, public std::enable_shared_from_this<HugePageArena> {
+  public:
+    static constexpr size_t HUGE_PAGE_SIZE = 1UL << 21;
+    static constexpr size_t MIN_ARENA_ALLOCATION = HUGE_PAGE_SIZE;
+
+    // Cache limit where the physical memory cannot be queried
+    static constexpr size_t FALLBACK_MAX_CACHED_BYTES = 2UL << 30;
+
+    explicit HugePageArena(size_t max_cached_bytes = default_max_cached_bytes())
+        : max_cached_bytes(max_cached_bytes)
+    {}
+    ~HugePageArena() override;
+    HugePageArena(const HugePageArena& other) = delete;
+    HugePageArena(HugePageArena&& other) = delete;
+    HugePageArena& operator=(const HugePageArena& other) = delete;
+    HugePageArena& operator=(HugePageArena&& other) = delete;
+
+    std::shared_ptr<void> allocate(size_t size) override;
+
+    PolynomialArenaStats get_stats();
+
+    /**
+     * @brief Unmap the cached buffers
+     */
+    void trim();
+
+    /**
+     * @brief A quarter of the physical memory, or FALLBACK_MAX_CACHED_BYTES where it is unknown
+     */
+    static size_t default_max_cached_bytes();
+
+  private:
+    // (rounded size, buffer) of a cached buffer
+    using CachedBuffers = std::list<std::pair<size_t, void*>>;
+
+    void* map(size_t size);
+    void release(void* ptr, size_t size);
+
+    size_t max_cached_bytes;
+    // Cached buffers, released most recently first
+    CachedBuffers cached_buffers;
+    // Cached buffers by (rounded) size, released least recently first
+    std::map<size_t, std::vector<CachedBuffers::iterator>> free_buffers;
+    PolynomialArenaStats stats;
+    bool hugetlb_available = true;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+};
+
+/**
+ * @brief Install the arena serving polynomial allocations; nullptr restores the slab allocator
+ */
+void set_polynomial_arena(std::shared_ptr<PolynomialArena> arena);
+std::shared_ptr<PolynomialArena> get_polynomial_arena();
+
+/**
+ * @brief Backing memory for a polynomial, from the installed arena or else the slab allocator
+ */
+std::shared_ptr<void> allocate_polynomial_memory(size_t size);
+
+/**
+ * @brief Peak resident set size of the process in bytes, 0 where unavailable
+ */
+size_t get_peak_rss_bytes();
+
+} // namespace bb
@@ -0,0 +1,113 @@
+#include "barretenberg/polynomials/polynomial_arena.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+TEST(PolynomialArena, ReusesReleasedBuffers)
+{
+    auto arena = std::make_shared<HugePageArena>();
+    const size_t size = 3 * HugePageArena::HUGE_PAGE_SIZE + 5;
+
+    void* first_ptr = nullptr;
+    {
+        auto buffer = arena->allocate(size);
+        first_ptr = buffer.get();
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(first_ptr) % 32, 0);
+        // The whole buffer is usable
+        static_cast<uint8_t*>(buffer.get())[size - 1] = 1;
+        EXPECT_EQ(arena->get_stats().cached_bytes, 0);
+    }
+    auto stats = arena->get_stats();
+    EXPECT_EQ(stats.cached_bytes, 4 * HugePageArena::HUGE_PAGE_SIZE);
+    EXPECT_EQ(stats.mapped_bytes, 4 * HugePageArena::HUGE_PAGE_SIZE);
+
+    // A request of the same rounded size gets the cached buffer, a different size gets a new one
+    auto same = arena->allocate(size - 2);
+    EXPECT_EQ(same.get(), first_ptr);
+    auto other = arena->allocate(HugePageArena::HUGE_PAGE_SIZE);
+    EXPECT_NE(other.get(), first_ptr);
+
+    stats = arena->get_stats();
+    EXPECT_EQ(stats.num_allocations, 3);
+    EXPECT_EQ(stats.num_reused, 1);
+    EXPECT_EQ(stats.cached_bytes, 0);
+    EXPECT_EQ(stats.peak_mapped_bytes, 5 * HugePageArena::HUGE_PAGE_SIZE);
+
+    // Small allocations are not served by the arena
+    auto small = arena->allocate(1024);
+    EXPECT_NE(small.get(), nullptr);
+    EXPECT_EQ(arena->get_stats().num_allocations, 3);
+}
+
+TEST(PolynomialArena, CacheLimitAndTrim)
+{
+    auto arena = std::make_shared<HugePageArena>(HugePageArena::HUGE_PAGE_SIZE);
+    {
+        auto a = arena->allocate(HugePageArena::HUGE_PAGE_SIZE);
+        auto b = arena->allocate(HugePageArena::HUGE_PAGE_SIZE);
+    }
+    // Only one buffer fits in the cache, the other one is unmapped
+    auto stats = arena->get_stats();
+    EXPECT_EQ(stats.cached_bytes, HugePageArena::HUGE_PAGE_SIZE);
+    EXPECT_EQ(stats.mapped_bytes, HugePageArena::HUGE_PAGE_SIZE);
+
+    arena->trim();
+    stats = arena->get_stats();
+    EXPECT_EQ(stats.cached_bytes, 0);
+    EXPECT_EQ(stats.mapped_bytes, 0);
+}
+
+TEST(PolynomialArena, EvictsBuffersReleasedLongestAgo)
+{
+    const size_t page = HugePageArena::HUGE_PAGE_SIZE;
+    auto arena = std::make_shared<HugePageArena>(3 * page);
+    EXPECT_LT(HugePageArena::default_max_cached_bytes(), static_cast<size_t>(-1));
+
+    void* stale_ptr = nullptr;
+    {
+        // Buffers of an earlier circuit fill most of the cache
+        auto stale = arena->allocate(2 * page);
+        stale_ptr = stale.get();
+    }
+    {
+        auto recent = arena->allocate(page);
+        auto newest = arena->allocate(2 * page);
+        EXPECT_EQ(newest.get(), stale_ptr);
+    }
+    {
+        auto newest = arena->allocate(2 * page);
+        auto other = arena->allocate(2 * page);
+    }
+    // The last released 2 page buffer displaces the 1 page one and the other 2 page one
+    auto stats = arena->get_stats();
+    EXPECT_EQ(stats.cached_bytes, 2 * page);
+    EXPECT_EQ(stats.mapped_bytes, 2 * page);
+    EXPECT_EQ(stats.num_evictions, 2);
+    EXPECT_EQ(arena->allocate(2 * page).get(), stale_ptr);
+
+    // A buffer larger than the whole cache is unmapped right away
+    arena->allocate(4 * page);
+    EXPECT_EQ(arena->get_stats().cached_bytes, 2 * page);
+}
+
+TEST(PolynomialArena, ServesPolynomials)
+{
+    using FF = bb::fr;
+    const size_t size = HugePageArena::HUGE_PAGE_SIZE / sizeof(FF) * 2;
+    auto arena = std::make_shared<HugePageArena>();
+    set_polynomial_arena(arena);
+    for (size_t proof = 0; proof < 3; ++proof) {
+        Polynomial<FF> poly(size);
+        poly.at(size - 1) = FF(proof);
+        Polynomial<FF> copy(poly);
+        EXPECT_EQ(copy[size - 1], FF(proof));
+        EXPECT_TRUE(copy[0].is_zero());
+    }
+    set_polynomial_arena(nullptr);
+    // Two buffers per iteration, reused after the first one
+    auto stats = arena->get_stats();
+    EXPECT_EQ(stats.num_allocations, 6);
+    EXPECT_EQ(stats.num_reused, 4);
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+
+namespace bb {
+
+/**
+ * @brief A column of the prover polynomials, read at a row index shared by all the columns of a row view
+ * @details A Flavor::AllEntities<PolynomialAtRow<FF>> set up once over the prover polynomials stands in for
+ * get_row(i), which copies every column of the row: a relation evaluated on it only reads the columns it uses, and
+ * moving the view to the next row is a single store to the shared index.
+ */
+template <typename FF> class PolynomialAtRow {
+  public:
+    PolynomialAtRow() = default;
+    PolynomialAtRow(const Polynomial<FF>& polynomial, const size_t& row_idx)
+        : polynomial(&polynomial)
+        , row_idx(&row_idx)
+    {}
+
+    operator const FF&() const { return polynomial->get(*row_idx); }
+
+    // The relations' skip conditions call these on the entities directly rather than on their views
+    bool is_zero() const { return polynomial->get(*row_idx).is_zero(); }
+    friend FF operator-(const PolynomialAtRow& lhs, const PolynomialAtRow& rhs)
+    {
+        return static_cast<const FF&>(lhs) - static_cast<const FF&>(rhs);
+    }
+
+    friend bool operator==(const PolynomialAtRow& column, const FF& value)
+    {
+        return static_cast<const FF&>(column) == value;
+    }
+
+  private:
+    const Polynomial<FF>* polynomial = nullptr;
+    const size_t* row_idx = nullptr;
+};
+
+} // namespace bb
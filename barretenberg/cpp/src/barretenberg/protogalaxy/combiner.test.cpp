@@ -340,4 +340,50 @@ TEST(Protogalaxy, CombinerOptimizationConsistency)
     };
     run_test(true);
     run_test(false);
-};
\ No newline at end of file
+};
+// Check that restricting the combiner to the rows on which the keys are active does not change it
+TEST(Protogalaxy, CombinerActiveRanges)
+{
+    constexpr size_t NUM_KEYS = 2;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using DeciderProvingKeys = DeciderProvingKeys_<Flavor, NUM_KEYS>;
+    using Fun = ProtogalaxyProverInternal<DeciderProvingKeys>;
+
+    constexpr size_t log_circuit_size = 4;
+    constexpr size_t circuit_size = 1 << log_circuit_size;
+    const RowRanges active_ranges{ { 1, 3 }, { 6, 11 } };
+
+    // Random values on the active rows and zero elsewhere, on which every relation vanishes
+    std::vector<std::shared_ptr<DeciderProvingKey>> keys_data(NUM_KEYS);
+    for (auto& key : keys_data) {
+        key = std::make_shared<DeciderProvingKey>();
+        key->proving_key.polynomials = get_zero_prover_polynomials<Flavor>(log_circuit_size);
+        key->proving_key.circuit_size = circuit_size;
+        key->proving_key.log_circuit_size = log_circuit_size;
+        for (auto& poly : key->proving_key.polynomials.get_all()) {
+            for (const auto& [start, end] : active_ranges) {
+                for (size_t i = start; i < end; i++) {
+                    poly.at(i) = FF::random_element();
+                }
+            }
+        }
+    }
+    DeciderProvingKeys keys{ keys_data };
+
+    Fun::UnivariateRelationSeparator alphas;
+    for (auto& alpha : alphas) {
+        alpha = bb::Univariate<FF, DeciderProvingKeys::BATCHED_EXTENDED_LENGTH>::get_random();
+    }
+    std::vector<FF> betas(log_circuit_size);
+    for (auto& beta : betas) {
+        beta = FF::random_element();
+    }
+    GateSeparatorPolynomial<FF> gate_separators(betas, log_circuit_size);
+    auto relation_parameters = Fun::UnivariateRelationParametersNoOptimisticSkipping::get_random();
+
+    Fun::TupleOfTuplesOfUnivariatesNoOptimisticSkipping accumulators;
+    auto result_all_rows = Fun::compute_combiner(keys, gate_separators, relation_parameters, alphas, accumulators);
+    auto result_active_rows =
+        Fun::compute_combiner(keys, gate_separators, relation_parameters, alphas, accumulators, active_ranges);
+    EXPECT_EQ(result_all_rows, result_active_rows);
+}
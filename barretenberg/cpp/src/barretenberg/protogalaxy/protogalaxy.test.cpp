@@ -226,6 +226,71 @@ template <typename Flavor> class ProtogalaxyTests : public testing::Test {
         EXPECT_EQ(perturbator[0], target_sum);
     }
 
+    /**
+     * @brief Check that the single pass perturbator computation agrees with building the tree over the row evaluations
+     *
+     */
+    static void test_pertubator_coefficients_single_pass()
+    {
+        using RelationSeparator = typename Flavor::RelationSeparator;
+        const size_t log_size(10);
+        const size_t size(1 << log_size);
+        ProverPolynomials full_polynomials;
+        for (auto& poly : full_polynomials.get_all()) {
+            poly = bb::Polynomial<FF>::random(size);
+        }
+        auto relation_parameters = bb::RelationParameters<FF>::get_random();
+        RelationSeparator alphas;
+        for (auto& alpha : alphas) {
+            alpha = FF::random_element();
+        }
+        std::vector<FF> betas(log_size);
+        std::vector<FF> deltas(log_size);
+        for (size_t idx = 0; idx < log_size; idx++) {
+            betas[idx] = FF::random_element();
+            deltas[idx] = FF::random_element();
+        }
+
+        auto full_honk_evals = Fun::compute_row_evaluations(full_polynomials, alphas, relation_parameters);
+        auto expected_perturbator = Fun::construct_perturbator_coefficients(betas, deltas, full_honk_evals);
+        auto perturbator =
+            Fun::compute_perturbator_coefficients(full_polynomials, alphas, relation_parameters, betas, deltas);
+        EXPECT_EQ(perturbator, expected_perturbator);
+    }
+
+    /**
+     * @brief Check that restricting the perturbator computation to the active rows of a structured accumulator does
+     * not change it
+     *
+     */
+    static void test_pertubator_coefficients_active_ranges()
+    {
+        TupleOfKeys keys = construct_keys(2, TraceStructure::SMALL_TEST);
+        auto accumulator = std::get<0>(fold_and_verify(get<0>(keys), get<1>(keys)));
+        const RowRanges active_ranges = accumulator->get_active_row_ranges();
+        EXPECT_FALSE(active_ranges.empty());
+        EXPECT_LT(count_rows(active_ranges), accumulator->proving_key.circuit_size);
+
+        const size_t log_size = accumulator->proving_key.log_circuit_size;
+        std::vector<FF> betas(log_size);
+        std::vector<FF> deltas(log_size);
+        for (size_t idx = 0; idx < log_size; idx++) {
+            betas[idx] = FF::random_element();
+            deltas[idx] = FF::random_element();
+        }
+
+        const auto& polynomials = accumulator->proving_key.polynomials;
+        const auto& alphas = accumulator->alphas;
+        const auto& relation_parameters = accumulator->relation_parameters;
+        auto full_honk_evals = Fun::compute_row_evaluations(polynomials, alphas, relation_parameters);
+        EXPECT_EQ(Fun::compute_row_evaluations(polynomials, alphas, relation_parameters, active_ranges),
+                  full_honk_evals);
+        auto expected_perturbator = Fun::construct_perturbator_coefficients(betas, deltas, full_honk_evals);
+        auto perturbator = Fun::compute_perturbator_coefficients(
+            polynomials, alphas, relation_parameters, betas, deltas, active_ranges);
+        EXPECT_EQ(perturbator, expected_perturbator);
+    }
+
     /**
      * @brief Manually compute the expected evaluations of the combiner quotient, given evaluations of the combiner
      * and check them against the evaluations returned by the function.
@@ -580,6 +645,16 @@ TYPED_TEST(ProtogalaxyTests, PerturbatorPolynomial)
     TestFixture::test_pertubator_polynomial();
 }
 
+TYPED_TEST(ProtogalaxyTests, PerturbatorCoefficientsSinglePass)
+{
+    TestFixture::test_pertubator_coefficients_single_pass();
+}
+
+TYPED_TEST(ProtogalaxyTests, PerturbatorCoefficientsActiveRanges)
+{
+    TestFixture::test_pertubator_coefficients_active_ranges();
+}
+
 TYPED_TEST(ProtogalaxyTests, CombinerQuotient)
 {
     TestFixture::test_combiner_quotient();
@@ -92,7 +92,8 @@ ProtogalaxyProver_<DeciderProvingKeys>::combiner_quotient_round(const std::vecto
         Fun::template compute_extended_relation_parameters<UnivariateRelationParameters>(keys);
 
     TupleOfTuplesOfUnivariates accumulators;
-    auto combiner = Fun::compute_combiner(keys, gate_separators, relation_parameters, alphas, accumulators);
+    auto combiner = Fun::compute_combiner(
+        keys, gate_separators, relation_parameters, alphas, accumulators, Fun::compute_active_row_ranges(keys));
 
     const FF perturbator_evaluation = perturbator.evaluate(perturbator_challenge);
     const CombinerQuotient combiner_quotient = Fun::compute_combiner_quotient(perturbator_evaluation, combiner);
@@ -132,6 +133,14 @@ FoldingResult<typename DeciderProvingKeys::Flavor> ProtogalaxyProver_<DeciderPro
     result.accumulator->target_sum = perturbator_evaluation * lagranges[0] +
                                      vanishing_polynomial_at_challenge * combiner_quotient.evaluate(combiner_challenge);
 
+    // The folded polynomials are active wherever one of the keys is
+    RowRanges active_ranges;
+    for (size_t key_idx = 0; key_idx < DeciderProvingKeys::NUM; key_idx++) {
+        const auto& key_ranges = keys[key_idx]->proving_key.active_block_ranges;
+        active_ranges.insert(active_ranges.end(), key_ranges.begin(), key_ranges.end());
+    }
+    result.accumulator->proving_key.active_block_ranges = normalize_row_ranges(std::move(active_ranges));
+
     // Fold the proving key polynomials
     for (auto& poly : result.accumulator->proving_key.polynomials.get_unshifted()) {
         poly *= lagranges[0];
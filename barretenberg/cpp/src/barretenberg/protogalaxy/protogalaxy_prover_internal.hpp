@@ -2,11 +2,14 @@
 #include "barretenberg/common/container.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/honk/proof_system/active_ranges.hpp"
+#include "barretenberg/polynomials/polynomial_at_row.hpp"
 #include "barretenberg/protogalaxy/prover_verifier_shared.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/ultra_honk/oink_prover.hpp"
+#include <bit>
 
 namespace bb {
 
@@ -24,7 +27,7 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
     using RelationUtils = bb::RelationUtils<Flavor>;
     using ProverPolynomials = typename Flavor::ProverPolynomials;
     using Relations = typename Flavor::Relations;
-    using AllValues = typename Flavor::AllValues;
+    using RowView = typename Flavor::template AllEntities<PolynomialAtRow<FF>>;
     using RelationSeparator = typename Flavor::RelationSeparator;
     static constexpr size_t NUM_KEYS = DeciderProvingKeys_::NUM;
     using UnivariateRelationParametersNoOptimisticSkipping =
@@ -55,6 +58,19 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
 
     static constexpr size_t NUM_SUBRELATIONS = DeciderPKs::NUM_SUBRELATIONS;
 
+    /**
+     * @brief A view of the prover polynomials at row row_idx, which follows row_idx as it changes, so that a relation
+     * evaluated on it reads only the columns it uses
+     */
+    static RowView make_row_view(const ProverPolynomials& polynomials, const size_t& row_idx)
+    {
+        RowView row;
+        for (auto [column, polynomial] : zip_view(row.get_all(), polynomials.get_all())) {
+            column = PolynomialAtRow<FF>(polynomial, row_idx);
+        }
+        return row;
+    }
+
     /**
      * @brief A scale subrelations evaluations by challenges ('alphas') and part of the linearly dependent relation
      * evaluation(s).
@@ -103,17 +119,23 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
      * over each row. At the end of the function, the linearly dependent contribution is accumulated at index 0
      * representing the sum f_0(ω) + α_j*g(ω) where f_0 represents the full honk evaluation at row 0, g(ω) is the
      * linearly dependent subrelation and α_j is its corresponding batching challenge.
+     *
+     * @param active_ranges Rows outside of which all relations vanish (see DeciderProvingKey_::get_active_row_ranges),
+     * empty for all rows. The evaluations at the other rows are zero.
      */
     static std::vector<FF> compute_row_evaluations(const ProverPolynomials& polynomials,
                                                    const RelationSeparator& alphas_,
-                                                   const RelationParameters<FF>& relation_parameters)
+                                                   const RelationParameters<FF>& relation_parameters,
+                                                   const RowRanges& active_ranges = {})
 
     {
 
         PROFILE_THIS_NAME("ProtogalaxyProver_::compute_row_evaluations");
 
         const size_t polynomial_size = polynomials.get_polynomial_size();
-        std::vector<FF> aggregated_relation_evaluations(polynomial_size);
+        std::vector<FF> aggregated_relation_evaluations(polynomial_size, FF(0));
+        const RowRanges rows = active_ranges.empty() ? RowRanges{ { 0, polynomial_size } } : active_ranges;
+        const size_t num_rows = count_rows(rows);
 
         const std::array<FF, NUM_SUBRELATIONS> alphas = [&alphas_]() {
             std::array<FF, NUM_SUBRELATIONS> tmp;
@@ -122,20 +144,25 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
             return tmp;
         }();
 
-        const std::vector<FF> linearly_dependent_contribution_accumulators = parallel_for_heuristic(
-            polynomial_size,
-            /*accumulator default*/ FF(0),
-            [&](size_t row_idx, FF& linearly_dependent_contribution_accumulator) {
-                const AllValues row = polynomials.get_row(row_idx);
-                // Evaluate all subrelations on the given row. Separator is 1 since we are not summing across rows here.
-                const RelationEvaluations evals =
-                    RelationUtils::accumulate_relation_evaluations(row, relation_parameters, FF(1));
-
-                // Sum against challenges alpha
-                aggregated_relation_evaluations[row_idx] =
-                    process_subrelation_evaluations(evals, alphas, linearly_dependent_contribution_accumulator);
-            },
-            thread_heuristics::ALWAYS_MULTITHREAD);
+        const size_t num_threads = std::max(calculate_num_threads(num_rows), size_t(1));
+        std::vector<FF> linearly_dependent_contribution_accumulators(num_threads, FF(0));
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            size_t row_idx = 0;
+            const RowView row = make_row_view(polynomials, row_idx);
+            const RowRanges thread_rows = slice_row_ranges(
+                rows, thread_idx * num_rows / num_threads, (thread_idx + 1) * num_rows / num_threads);
+            for (const auto& [start, end] : thread_rows) {
+                for (row_idx = start; row_idx < end; row_idx++) {
+                    // Evaluate all subrelations on the row, with separator 1 as we are not summing across rows here
+                    const RelationEvaluations evals =
+                        RelationUtils::accumulate_relation_evaluations(row, relation_parameters, FF(1));
+
+                    // Sum against challenges alpha
+                    aggregated_relation_evaluations[row_idx] = process_subrelation_evaluations(
+                        evals, alphas, linearly_dependent_contribution_accumulators[thread_idx]);
+                }
+            }
+        });
         aggregated_relation_evaluations[0] += sum(linearly_dependent_contribution_accumulators);
 
         return aggregated_relation_evaluations;
@@ -199,6 +226,109 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         return construct_coefficients_tree(betas, deltas, first_level_coeffs);
     }
 
+    /**
+     * @brief Compute the perturbator coefficients of construct_perturbator_coefficients in a single pass over the rows,
+     * without materializing the row evaluations of compute_row_evaluations
+     * @details The rows are split into a power of 2 number of contiguous chunks, one per thread, each the leaves of a
+     * subtree. A thread evaluates its rows on the fly and folds each into its subtree as soon as it is computed,
+     * keeping one pending left node per level: a right node completed at level l is merged with the pending node
+     * n_l into n_l + n_r * (β_l + δ_l X). The subtree roots are then combined over the remaining levels by
+     * construct_coefficients_tree. The linearly dependent contribution belongs to row 0, whose branches to the root
+     * are all labelled 1, so it is added to the constant coefficient.
+     *
+     * Rows outside of the active ranges evaluate to zero, so an aligned block of 2^l such rows is a subtree whose
+     * coefficients are all zero: it is folded in as a single node at level l without visiting its rows.
+     *
+     * @param active_ranges Rows outside of which all relations vanish (see DeciderProvingKey_::get_active_row_ranges),
+     * empty for all rows
+     */
+    static std::vector<FF> compute_perturbator_coefficients(const ProverPolynomials& polynomials,
+                                                            const RelationSeparator& alphas_,
+                                                            const RelationParameters<FF>& relation_parameters,
+                                                            std::span<const FF> betas,
+                                                            std::span<const FF> deltas,
+                                                            const RowRanges& active_ranges = {})
+    {
+        PROFILE_THIS_NAME("ProtogalaxyProver_::compute_perturbator_coefficients");
+
+        const size_t log_size = betas.size();
+        ASSERT(polynomials.get_polynomial_size() == (size_t(1) << log_size));
+
+        const std::array<FF, NUM_SUBRELATIONS> alphas = [&alphas_]() {
+            std::array<FF, NUM_SUBRELATIONS> tmp;
+            tmp[0] = 1;
+            std::copy(alphas_.begin(), alphas_.end(), tmp.begin() + 1);
+            return tmp;
+        }();
+
+        // A power of 2 number of threads, each with at least min_rows_per_thread rows
+        constexpr size_t log_min_rows_per_thread = 6;
+        size_t log_num_threads = numeric::get_msb(get_num_cpus_pow2());
+        log_num_threads = std::min(log_num_threads,
+                                   log_size > log_min_rows_per_thread ? log_size - log_min_rows_per_thread : 0);
+        const size_t num_threads = size_t(1) << log_num_threads;
+        const size_t log_subtree_size = log_size - log_num_threads;
+        const size_t polynomial_size = size_t(1) << log_size;
+        const RowRanges rows = active_ranges.empty() ? RowRanges{ { 0, polynomial_size } } : active_ranges;
+
+        std::vector<std::vector<FF>> subtree_coeffs(num_threads, std::vector<FF>(log_subtree_size + 1));
+        std::vector<FF> linearly_dependent_contributions(num_threads, FF(0));
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            // pending[l] holds the coefficients (degree l) of the left node waiting for its sibling at level l
+            std::vector<std::vector<FF>> pending(log_subtree_size);
+            for (size_t level = 0; level < log_subtree_size; level++) {
+                pending[level].resize(level + 1);
+            }
+            std::vector<FF>& node = subtree_coeffs[thread_idx];
+            const size_t start = thread_idx << log_subtree_size;
+            size_t row_idx = 0;
+            const RowView row = make_row_view(polynomials, row_idx);
+            auto range = rows.begin();
+            for (size_t idx = 0; idx < (size_t(1) << log_subtree_size);) {
+                row_idx = start + idx;
+                while (range != rows.end() && range->second <= row_idx) {
+                    range++;
+                }
+                const size_t next_active_row = range == rows.end() ? polynomial_size : std::max(range->first, row_idx);
+
+                size_t level = 0;
+                if (next_active_row == row_idx) {
+                    const RelationEvaluations evals =
+                        RelationUtils::accumulate_relation_evaluations(row, relation_parameters, FF(1));
+                    node[0] =
+                        process_subrelation_evaluations(evals, alphas, linearly_dependent_contributions[thread_idx]);
+                } else {
+                    // The largest inactive subtree starting at idx
+                    const size_t max_aligned_level =
+                        idx == 0 ? log_subtree_size : static_cast<size_t>(std::countr_zero(idx));
+                    level = std::min(max_aligned_level,
+                                     static_cast<size_t>(numeric::get_msb(uint64_t(next_active_row - row_idx))));
+                    std::fill_n(node.begin(), level + 1, FF(0));
+                }
+                const size_t num_leaves = size_t(1) << level;
+
+                // The node is a right child at each level where idx has a 1 bit
+                for (; ((idx >> level) & 1) != 0; level++) {
+                    const std::vector<FF>& left = pending[level];
+                    node[level + 1] = node[level] * deltas[level];
+                    for (size_t d = level; d > 0; d--) {
+                        node[d] = left[d] + node[d] * betas[level] + node[d - 1] * deltas[level];
+                    }
+                    node[0] = left[0] + node[0] * betas[level];
+                }
+                if (level < log_subtree_size) {
+                    std::copy_n(node.begin(), level + 1, pending[level].begin());
+                }
+                idx += num_leaves;
+            }
+        });
+
+        std::vector<FF> perturbator =
+            construct_coefficients_tree(betas, deltas, subtree_coeffs, /*level=*/log_subtree_size);
+        perturbator[0] += sum(linearly_dependent_contributions);
+        return perturbator;
+    }
+
     /**
      * @brief Construct the power perturbator polynomial F(X) in coefficient form from the accumulator
      */
@@ -206,16 +336,17 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
                                               const std::vector<FF>& deltas)
     {
         PROFILE_THIS();
-        auto full_honk_evaluations = compute_row_evaluations(
-            accumulator->proving_key.polynomials, accumulator->alphas, accumulator->relation_parameters);
         const auto betas = accumulator->gate_challenges;
         ASSERT(betas.size() == deltas.size());
         const size_t log_circuit_size = accumulator->proving_key.log_circuit_size;
 
         // Compute the perturbator using only the first log_circuit_size-many betas/deltas
-        std::vector<FF> perturbator = construct_perturbator_coefficients(std::span{ betas.data(), log_circuit_size },
-                                                                         std::span{ deltas.data(), log_circuit_size },
-                                                                         full_honk_evaluations);
+        std::vector<FF> perturbator = compute_perturbator_coefficients(accumulator->proving_key.polynomials,
+                                                                       accumulator->alphas,
+                                                                       accumulator->relation_parameters,
+                                                                       std::span{ betas.data(), log_circuit_size },
+                                                                       std::span{ deltas.data(), log_circuit_size },
+                                                                       accumulator->get_active_row_ranges());
 
         // Populate the remaining coefficients with zeros to reach the required constant size
         for (size_t idx = log_circuit_size; idx < CONST_PG_LOG_N; ++idx) {
@@ -239,12 +370,44 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         const DeciderPKs& keys,
         const size_t row_idx)
     {
-        auto incoming_univariates = keys.template row_to_univariates<ExtendedUnivariate::LENGTH, skip_count>(row_idx);
-        for (auto [extended_univariate, incoming_univariate] :
-             zip_view(extended_univariates.get_all(), incoming_univariates)) {
-            incoming_univariate.template self_extend_from<NUM_KEYS>();
-            extended_univariate = std::move(incoming_univariate);
+        if constexpr (NUM_KEYS == 2) {
+            // Write both rows straight into the extended univariates rather than through the array of univariates
+            // built by row_to_univariates
+            for (auto [extended_univariate, poly_0, poly_1] :
+                 zip_view(extended_univariates.get_all(),
+                          keys[0]->proving_key.polynomials.get_all(),
+                          keys[1]->proving_key.polynomials.get_all())) {
+                extended_univariate.value_at(0) = poly_0[row_idx];
+                extended_univariate.value_at(1) = poly_1[row_idx];
+                extended_univariate.template self_extend_from<2>();
+            }
+        } else {
+            auto incoming_univariates =
+                keys.template row_to_univariates<ExtendedUnivariate::LENGTH, skip_count>(row_idx);
+            for (auto [extended_univariate, incoming_univariate] :
+                 zip_view(extended_univariates.get_all(), incoming_univariates)) {
+                incoming_univariate.template self_extend_from<NUM_KEYS>();
+                extended_univariate = std::move(incoming_univariate);
+            }
+        }
+    }
+
+    /**
+     * @brief The rows on which some key is active, outside of which every relation vanishes for every key and hence
+     * for every Lagrange combination of them (see DeciderProvingKey_::get_active_row_ranges)
+     * @return The union of the active rows of the keys, empty (i.e. all rows) unless every key is structured
+     */
+    static RowRanges compute_active_row_ranges(const DeciderPKs& keys)
+    {
+        RowRanges active_ranges;
+        for (const auto& key : keys) {
+            RowRanges key_ranges = key->get_active_row_ranges();
+            if (key_ranges.empty()) {
+                return {};
+            }
+            active_ranges.insert(active_ranges.end(), key_ranges.begin(), key_ranges.end());
         }
+        return normalize_row_ranges(std::move(active_ranges));
     }
 
     /**
@@ -307,6 +470,8 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
      * @tparam skip_zero_computations whether to use the optimization that skips computing zero.
      * @param
      * @param gate_separators
+     * @param active_ranges Rows outside of which all relations vanish for every key (see compute_active_row_ranges),
+     * empty for all rows. Only these rows are visited, split evenly across threads.
      * @return ExtendedUnivariateWithRandomization
      */
     template <typename Parameters, typename TupleOfTuples>
@@ -314,7 +479,8 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
                                                                 const GateSeparatorPolynomial<FF>& gate_separators,
                                                                 const Parameters& relation_parameters,
                                                                 const UnivariateRelationSeparator& alphas,
-                                                                TupleOfTuples& univariate_accumulators)
+                                                                TupleOfTuples& univariate_accumulators,
+                                                                const RowRanges& active_ranges = {})
     {
         PROFILE_THIS();
 
@@ -322,18 +488,18 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         constexpr bool skip_zero_computations = std::same_as<TupleOfTuples, TupleOfTuplesOfUnivariates>;
 
         const size_t common_polynomial_size = keys[0]->proving_key.circuit_size;
+        const RowRanges rows = active_ranges.empty() ? RowRanges{ { 0, common_polynomial_size } } : active_ranges;
+        const size_t num_rows = count_rows(rows);
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a
-        // single thread. For now we use a power of 2 number of threads simply to ensure the round size is evenly
-        // divided.
+        // single thread.
         const size_t max_num_threads = get_num_cpus_pow2(); // number of available threads (power of 2)
         const size_t min_iterations_per_thread =
             1 << 6; // min number of iterations for which we'll spin up a unique thread
-        const size_t desired_num_threads = common_polynomial_size / min_iterations_per_thread;
-        size_t num_threads = std::min(desired_num_threads, max_num_threads);       // fewer than max if justified
-        num_threads = num_threads > 0 ? num_threads : 1;                           // ensure num threads is >= 1
-        const size_t iterations_per_thread = common_polynomial_size / num_threads; // actual iterations per thread
+        const size_t desired_num_threads = num_rows / min_iterations_per_thread;
+        size_t num_threads = std::min(desired_num_threads, max_num_threads); // fewer than max if justified
+        num_threads = num_threads > 0 ? num_threads : 1;                     // ensure num threads is >= 1
 
         // Univariates are optimised for usual PG, but we need the unoptimised version for tests (it's a version that
         // doesn't skip computation), so we need to define types depending on the template instantiation
@@ -354,25 +520,27 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
 
         // Accumulate the contribution from each sub-relation
         parallel_for(num_threads, [&](size_t thread_idx) {
-            const size_t start = thread_idx * iterations_per_thread;
-            const size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t idx = start; idx < end; idx++) {
-                // Instantiate univariates, possibly with skipping toto ignore computation in those indices (they are
-                // still available for skipping relations, but all derived univariate will ignore those evaluations)
-                // No need to initialise extended_univariates to 0, as it's assigned to.
-                constexpr size_t skip_count = skip_zero_computations ? DeciderPKs::NUM - 1 : 0;
-                extend_univariates<skip_count>(extended_univariates[thread_idx], keys, idx);
-
-                const FF pow_challenge = gate_separators[idx];
-
-                // Accumulate the i-th row's univariate contribution. Note that the relation parameters passed to
-                // this function have already been folded. Moreover, linear-dependent relations that act over the
-                // entire execution trace rather than on rows, will not be multiplied by the pow challenge.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_univariates[thread_idx],
-                                                relation_parameters, // these parameters have already been folded
-                                                pow_challenge);
+            const RowRanges thread_rows = slice_row_ranges(
+                rows, thread_idx * num_rows / num_threads, (thread_idx + 1) * num_rows / num_threads);
+
+            for (const auto& [start, end] : thread_rows) {
+                for (size_t idx = start; idx < end; idx++) {
+                    // Instantiate univariates, possibly with skipping toto ignore computation in those indices (they
+                    // are still available for skipping relations, but all derived univariate will ignore those
+                    // evaluations). No need to initialise extended_univariates to 0, as it's assigned to.
+                    constexpr size_t skip_count = skip_zero_computations ? DeciderPKs::NUM - 1 : 0;
+                    extend_univariates<skip_count>(extended_univariates[thread_idx], keys, idx);
+
+                    const FF pow_challenge = gate_separators[idx];
+
+                    // Accumulate the i-th row's univariate contribution. Note that the relation parameters passed to
+                    // this function have already been folded. Moreover, linear-dependent relations that act over the
+                    // entire execution trace rather than on rows, will not be multiplied by the pow challenge.
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_univariates[thread_idx],
+                                                    relation_parameters, // these parameters have already been folded
+                                                    pow_challenge);
+                }
             }
         });
 
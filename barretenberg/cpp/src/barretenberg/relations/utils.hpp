@@ -172,9 +172,9 @@ template <typename Flavor> class RelationUtils {
      * relation. This value is checked against the final value of the target total sum (called sigma_0 in the
      * thesis).
      */
-    template <typename Parameters>
+    template <typename Parameters, typename Evaluations = PolynomialEvaluations>
     // TODO(#224)(Cody): Input should be an array?
-    inline static RelationEvaluations accumulate_relation_evaluations(const PolynomialEvaluations& evaluations,
+    inline static RelationEvaluations accumulate_relation_evaluations(const Evaluations& evaluations,
                                                                       const Parameters& relation_parameters,
                                                                       const FF& partial_evaluation_result)
     {
@@ -186,8 +186,11 @@ template <typename Flavor> class RelationUtils {
         return result;
     }
 
-    template <typename Parameters, size_t relation_idx, bool consider_skipping = true>
-    inline static void accumulate_single_relation(const PolynomialEvaluations& evaluations,
+    template <typename Parameters,
+              size_t relation_idx,
+              bool consider_skipping = true,
+              typename Evaluations = PolynomialEvaluations>
+    inline static void accumulate_single_relation(const Evaluations& evaluations,
                                                   RelationEvaluations& relation_evaluations,
                                                   const Parameters& relation_parameters,
                                                   const FF& partial_evaluation_result)
@@ -7,6 +7,7 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/point_table_cache.hpp"
 
 namespace bb::srs::factories {
 
@@ -48,10 +49,11 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
 }
 
 template <typename Curve>
-FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
+FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree, bool cache_point_table)
     : path_(std::move(path))
     , prover_degree_(initial_degree)
     , verifier_degree_(initial_degree)
+    , cache_point_table_(cache_point_table)
 {}
 
 template <typename Curve>
@@ -60,7 +62,13 @@ std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get
     PROFILE_THIS();
 
     if (prover_degree_ < degree || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        if (cache_point_table_) {
+            prover_crs_ = load_or_create_point_table<Curve>(point_table_cache_path(path_, Curve::name), degree, [&]() {
+                return std::make_shared<FileProverCrs<Curve>>(degree, path_);
+            });
+        } else {
+            prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        }
         prover_degree_ = degree;
         vinfo("Initializing ", Curve::name, " prover CRS from file of size ", degree);
     }
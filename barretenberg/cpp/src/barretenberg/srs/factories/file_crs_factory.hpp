@@ -12,10 +12,13 @@ namespace bb::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ *
+ * If cache_point_table is set, the pippenger point table of the prover crs is persisted next to the transcript (see
+ * point_table_cache.hpp) and memory mapped on subsequent runs instead of being recomputed.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    FileCrsFactory(std::string path, size_t initial_degree = 0, bool cache_point_table = false);
     FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
@@ -26,6 +29,7 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
     std::string path_;
     size_t prover_degree_;
     size_t verifier_degree_;
+    bool cache_point_table_;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> verifier_crs_;
 };
@@ -58,6 +58,24 @@ MemBn254CrsFactory::MemBn254CrsFactory(std::vector<g1::affine_element> const& po
           prover_crs_->get_monomial_size());
 }
 
+MemBn254CrsFactory::MemBn254CrsFactory(std::shared_ptr<ProverCrs<curve::BN254>> prover_crs,
+                                       g2::affine_element const& g2_point)
+    : prover_crs_(std::move(prover_crs))
+{
+    // The point table holds the raw srs points at even indices.
+    auto g1_identity = g1::affine_element();
+    if (prover_crs_->get_monomial_size() > 0) {
+        g1_identity = prover_crs_->get_monomial_points()[0];
+    }
+
+    verifier_crs_ = std::make_shared<MemVerifierCrs>(g2_point, g1_identity);
+
+    vinfo("Initializing ",
+          curve::BN254::name,
+          " prover CRS from point table with num points = ",
+          prover_crs_->get_monomial_size());
+}
+
 std::shared_ptr<bb::srs::factories::ProverCrs<curve::BN254>> MemBn254CrsFactory::get_prover_crs(size_t degree)
 {
     PROFILE_THIS();
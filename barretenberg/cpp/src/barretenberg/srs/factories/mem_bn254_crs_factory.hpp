@@ -16,6 +16,10 @@ namespace bb::srs::factories {
 class MemBn254CrsFactory : public CrsFactory<curve::BN254> {
   public:
     MemBn254CrsFactory(std::vector<g1::affine_element> const& points, g2::affine_element const& g2_point);
+    /**
+     * @brief Construct from an already populated prover crs, e.g. a memory mapped pippenger point table.
+     */
+    MemBn254CrsFactory(std::shared_ptr<ProverCrs<curve::BN254>> prover_crs, g2::affine_element const& g2_point);
     MemBn254CrsFactory(MemBn254CrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<curve::BN254>> get_prover_crs(size_t degree) override;
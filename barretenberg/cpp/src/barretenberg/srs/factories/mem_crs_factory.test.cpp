@@ -3,6 +3,7 @@
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
 #include "file_crs_factory.hpp"
 #include <fstream>
 #include <gtest/gtest.h>
@@ -74,3 +75,27 @@ TEST(reference_string, mem_grumpkin_file_consistency)
                      sizeof(Grumpkin::AffineElement) * 1024 * 2),
               0);
 }
+
+TEST(reference_string, mem_prover_crs_extension)
+{
+    std::vector<g1::affine_element> points(32);
+    for (auto& point : points) {
+        point = g1::affine_element::random_element();
+    }
+    MemProverCrs<BN254> full_crs(points);
+    MemProverCrs<BN254> prefix_crs(std::vector<g1::affine_element>(points.begin(), points.begin() + 20));
+
+    size_t first_loaded = 0;
+    MemProverCrs<BN254> extended_crs(prefix_crs, points.size(), [&](size_t start, std::span<g1::affine_element> tail) {
+        first_loaded = start;
+        std::copy(points.begin() + static_cast<std::ptrdiff_t>(start), points.end(), tail.begin());
+    });
+
+    // Only the points past the prefix are loaded, and the point table matches one built from scratch
+    EXPECT_EQ(first_loaded, 20);
+    EXPECT_EQ(extended_crs.get_monomial_size(), points.size());
+    EXPECT_EQ(memcmp(extended_crs.get_monomial_points().data(),
+                     full_crs.get_monomial_points().data(),
+                     sizeof(g1::affine_element) * points.size() * 2),
+              0);
+}
@@ -3,6 +3,9 @@
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
+#include <algorithm>
+#include <functional>
+#include <span>
 
 namespace bb::srs::factories {
 // Common to both Grumpkin and Bn254, and generally curves regardless of pairing-friendliness
@@ -16,6 +19,36 @@ template <typename Curve> class MemProverCrs : public ProverCrs<Curve> {
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
     }
 
+    /**
+     * @brief Construct by letting load_points write the num_points raw srs points straight into the point table
+     * buffer, e.g. from a memory mapped transcript, avoiding an intermediate copy of the points.
+     */
+    MemProverCrs(size_t num_points, const std::function<void(std::span<typename Curve::AffineElement>)>& load_points)
+        : num_points(num_points)
+        , monomials_(scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points))
+    {
+        load_points({ monomials_.get(), num_points });
+        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    }
+
+    /**
+     * @brief Construct a crs of num_points points that extends prefix: its point table is copied as is and only the
+     * points past it are loaded, by load_points(index of the first, points), and get their endomorphism points.
+     */
+    MemProverCrs(ProverCrs<Curve>& prefix,
+                 size_t num_points,
+                 const std::function<void(size_t, std::span<typename Curve::AffineElement>)>& load_points)
+        : num_points(num_points)
+        , monomials_(scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points))
+    {
+        const size_t num_prefix_points = std::min(prefix.get_monomial_size(), num_points);
+        const auto prefix_table = prefix.get_monomial_points().first(2 * num_prefix_points);
+        std::copy(prefix_table.begin(), prefix_table.end(), monomials_.get());
+        auto* tail = monomials_.get() + 2 * num_prefix_points;
+        load_points(num_prefix_points, { tail, num_points - num_prefix_points });
+        scalar_multiplication::generate_pippenger_point_table<Curve>(tail, tail, num_points - num_prefix_points);
+    }
+
     std::span<typename Curve::AffineElement> get_monomial_points() override
     {
         return { monomials_.get(), num_points * 2 };
@@ -1,6 +1,8 @@
 #pragma once
 #include "../ecc/curves/bn254/bn254.hpp"
 #include "../ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/common/mapped_file.hpp"
+#include "barretenberg/common/thread.hpp"
 #include <concepts>
 #include <cstdint>
 #include <fstream>
@@ -92,6 +94,11 @@ template <typename Curve> class IO {
         }
         file.close();
 
+        manifest_to_host_order(manifest);
+    }
+
+    static void manifest_to_host_order(Manifest& manifest)
+    {
         manifest.transcript_number = ntohl(manifest.transcript_number);
         manifest.total_transcripts = ntohl(manifest.total_transcripts);
         manifest.total_g1_points = ntohl(manifest.total_g1_points);
@@ -281,6 +288,22 @@ template <typename Curve> class IO {
         byteswap<>(elements, buffer_size);
     }
 
+    /**
+     * @brief Convert num_elements transcript g1 points into their in-memory form, in parallel chunks.
+     */
+    static void read_affine_elements_from_buffer_parallel(AffineElement* elements,
+                                                          uint8_t const* buffer,
+                                                          size_t num_elements)
+    {
+        constexpr size_t transcript_element_size = sizeof(Fq) * 2;
+        static_assert(sizeof(AffineElement) == transcript_element_size);
+        parallel_for_range(num_elements, [&](size_t start, size_t end) {
+            read_affine_elements_from_buffer(&elements[start],
+                                             reinterpret_cast<char const*>(buffer + start * transcript_element_size),
+                                             (end - start) * transcript_element_size);
+        });
+    }
+
     static void read_transcript_g1(AffineElement* monomials, size_t degree, std::string const& dir)
     {
         size_t num = 0;
@@ -292,6 +315,32 @@ template <typename Curve> class IO {
         }
 
         while (num_read < degree) {
+#ifndef __wasm__
+            // Convert the points in place from the mapped file, rather than streaming them into the destination first
+            // and converting serially afterwards.
+            MappedFile file(path);
+            if (!file || file.size() < sizeof(Manifest)) {
+                throw_or_abort(format("Unable to read manifest of transcript file ", path, "."));
+            }
+            Manifest manifest;
+            memcpy((void*)&manifest, file.data().data(), sizeof(Manifest));
+            manifest_to_host_order(manifest);
+
+            auto offset = sizeof(Manifest);
+            const size_t num_to_read = std::min((size_t)manifest.num_g1_points, degree - num_read);
+            const size_t g1_buffer_size = sizeof(Fq) * 2 * num_to_read;
+            if (file.size() < offset + g1_buffer_size) {
+                throw_or_abort(format("Only read ",
+                                      file.size() - offset,
+                                      " bytes from transcript file ",
+                                      path,
+                                      " but expected ",
+                                      g1_buffer_size,
+                                      "."));
+            }
+            file.will_need(offset, g1_buffer_size);
+            read_affine_elements_from_buffer_parallel(&monomials[num_read], file.data().data() + offset, num_to_read);
+#else
             Manifest manifest;
             read_manifest(path, manifest);
 
@@ -306,6 +355,7 @@ template <typename Curve> class IO {
             // g1_buffer_size as the file may have been smaller than this.
             read_file_into_buffer(buffer, size, path, offset, g1_buffer_size);
             srs::IO<Curve>::byteswap(&monomials[num_read], size);
+#endif
 
             num_read += num_to_read;
             path = get_transcript_path(dir, ++num);
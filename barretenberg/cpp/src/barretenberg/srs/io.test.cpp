@@ -2,7 +2,10 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include <filesystem>
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 using namespace bb;
 
@@ -30,3 +33,27 @@ TEST(io, read_transcript_loads_well_formed_srs)
     }
     aligned_free(monomials);
 }
+
+TEST(io, read_transcript_g1_round_trips_written_transcript)
+{
+    const size_t num_points = 1000;
+    std::vector<g1::affine_element> points(num_points);
+    for (auto& point : points) {
+        point = g1::affine_element(g1::element::random_element());
+    }
+
+    auto dir = std::filesystem::temp_directory_path() / ("io_test_transcript_" + std::to_string(getpid()));
+    std::filesystem::create_directories(dir / "monomial");
+    srs::Manifest manifest{ 0, 1, num_points, 0, num_points, 0, 0 };
+    srs::IO<curve::BN254>::write_transcript(points.data(), manifest, dir.string());
+
+    // Read fewer points than the transcript holds, as the prover crs does.
+    const size_t degree = num_points - 1;
+    auto monomials = scalar_multiplication::point_table_alloc<g1::affine_element>(degree);
+    srs::IO<curve::BN254>::read_transcript_g1(monomials.get(), degree, dir.string());
+    for (size_t i = 0; i < degree; ++i) {
+        EXPECT_EQ(monomials.get()[i], points[i]);
+    }
+
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,253 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mapped_file.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifndef __wasm__
+#include <unistd.h>
+#endif
+
+namespace {
+
+using namespace bb;
+using namespace bb::srs;
+
+constexpr size_t CHECKSUM_CHUNK_SIZE = 1UL << 20;
+constexpr uint64_t CHECKSUM_PRIME = 0x9e3779b97f4a7c15ULL;
+
+uint64_t mix(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * @brief Hash a chunk using four independent lanes so that the multiply latency does not bound throughput.
+ */
+uint64_t hash_chunk(const uint8_t* data, size_t size, uint64_t seed)
+{
+    std::array<uint64_t, 4> lanes{ seed, seed + 1, seed + 2, seed + 3 };
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        for (size_t j = 0; j < 4; ++j) {
+            uint64_t word = 0;
+            std::memcpy(&word, data + i + 8 * j, sizeof(word));
+            lanes[j] = (lanes[j] ^ word) * CHECKSUM_PRIME;
+            lanes[j] ^= lanes[j] >> 29;
+        }
+    }
+    // Tail bytes are folded into the first lane.
+    for (; i < size; ++i) {
+        lanes[0] = (lanes[0] ^ data[i]) * CHECKSUM_PRIME;
+    }
+    uint64_t h = size;
+    for (const auto lane : lanes) {
+        h = mix(h ^ lane);
+    }
+    return h;
+}
+
+template <typename Curve> PointTableHeader make_header(size_t num_points, uint64_t checksum)
+{
+    PointTableHeader header;
+    header.element_size = static_cast<uint32_t>(sizeof(typename Curve::AffineElement));
+    header.num_points = num_points;
+    header.checksum = checksum;
+    std::string_view name(Curve::name);
+    std::copy_n(name.begin(), std::min(name.size(), PointTableHeader::CURVE_NAME_SIZE - 1), header.curve_name.begin());
+    return header;
+}
+
+/**
+ * @brief A prover crs whose pippenger point table lives in a copy-on-write file mapping.
+ * @details Pippenger and the commitment key only ever read the point table, so its pages stay shared with the page
+ * cache; the mapping is nevertheless writable (MAP_PRIVATE) as the ProverCrs interface hands out mutable points, and a
+ * write only ever touches a private copy of the page. The prefetch overflow region that point_table_alloc reserves past
+ * the table is not needed: it is only touched by __builtin_prefetch, which never faults.
+ */
+template <typename Curve> class MappedProverCrs : public factories::ProverCrs<Curve> {
+  public:
+    MappedProverCrs(MappedFile file, size_t num_points)
+        : file(std::move(file))
+        , num_points(num_points)
+    {}
+
+    std::span<typename Curve::AffineElement> get_monomial_points() override
+    {
+        auto* points =
+            reinterpret_cast<typename Curve::AffineElement*>(file.mutable_data().data() + sizeof(PointTableHeader));
+        return { points, num_points * 2 };
+    }
+
+    size_t get_monomial_size() const override { return num_points; }
+
+  private:
+    MappedFile file;
+    size_t num_points;
+};
+
+} // namespace
+
+namespace bb::srs {
+
+uint64_t point_table_checksum(std::span<const uint8_t> data)
+{
+    const size_t num_chunks = (data.size() + CHECKSUM_CHUNK_SIZE - 1) / CHECKSUM_CHUNK_SIZE;
+    std::vector<uint64_t> chunk_hashes(num_chunks);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        const size_t start = chunk * CHECKSUM_CHUNK_SIZE;
+        const size_t size = std::min(CHECKSUM_CHUNK_SIZE, data.size() - start);
+        chunk_hashes[chunk] = hash_chunk(data.data() + start, size, chunk);
+    });
+    uint64_t checksum = mix(data.size());
+    for (const auto chunk_hash : chunk_hashes) {
+        checksum = mix(checksum ^ chunk_hash) * CHECKSUM_PRIME;
+    }
+    return checksum;
+}
+
+std::filesystem::path point_table_cache_path(const std::filesystem::path& crs_dir, std::string_view curve_name)
+{
+    std::string name(curve_name);
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    return crs_dir / (name + "_g1_point_table.dat");
+}
+
+template <typename Curve>
+bool write_point_table(const std::filesystem::path& path, std::span<const typename Curve::AffineElement> point_table)
+{
+    PROFILE_THIS();
+
+    ASSERT(point_table.size() % 2 == 0);
+    const std::span<const uint8_t> payload(reinterpret_cast<const uint8_t*>(point_table.data()),
+                                           point_table.size_bytes());
+    const auto header = make_header<Curve>(point_table.size() / 2, point_table_checksum(payload));
+
+    auto tmp_path = path;
+#ifdef __wasm__
+    tmp_path += ".tmp";
+#else
+    tmp_path += ".tmp." + std::to_string(getpid());
+#endif
+    std::error_code ec;
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        file.close();
+        if (!file) {
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+    }
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+template <typename Curve>
+std::shared_ptr<factories::ProverCrs<Curve>> map_point_table(const std::filesystem::path& path,
+                                                             size_t min_num_points,
+                                                             bool verify_checksum)
+{
+    PROFILE_THIS();
+
+    MappedFile file(path.string(), /*copy_on_write=*/true);
+    if (!file || file.size() < sizeof(PointTableHeader)) {
+        return nullptr;
+    }
+
+    auto reject = [&](const std::string& reason) -> std::shared_ptr<factories::ProverCrs<Curve>> {
+        vinfo("ignoring cached point table at ", path, ": ", reason);
+        return nullptr;
+    };
+
+    PointTableHeader header;
+    std::memcpy(&header, file.data().data(), sizeof(header));
+    const auto expected = make_header<Curve>(0, 0);
+    if (header.magic != PointTableHeader::MAGIC || header.version != PointTableHeader::VERSION) {
+        return reject("unknown format");
+    }
+    if (header.element_size != expected.element_size || header.curve_name != expected.curve_name) {
+        return reject("written for a different curve");
+    }
+    const size_t payload_size = file.size() - sizeof(PointTableHeader);
+    if (header.num_points > payload_size / (2 * sizeof(typename Curve::AffineElement)) ||
+        payload_size != header.num_points * 2 * sizeof(typename Curve::AffineElement)) {
+        return reject("truncated");
+    }
+    if (header.num_points < min_num_points) {
+        return reject("too few points");
+    }
+    if (verify_checksum) {
+        if (point_table_checksum(file.data().subspan(sizeof(PointTableHeader))) != header.checksum) {
+            return reject("checksum mismatch");
+        }
+    }
+
+    vinfo("using cached ", Curve::name, " point table of size ", header.num_points, " at ", path);
+    return std::make_shared<MappedProverCrs<Curve>>(std::move(file), static_cast<size_t>(header.num_points));
+}
+
+template <typename Curve>
+std::shared_ptr<factories::ProverCrs<Curve>> load_or_create_point_table(
+    const std::filesystem::path& path,
+    size_t num_points,
+    const std::function<std::shared_ptr<factories::ProverCrs<Curve>>()>& build_crs,
+    bool write_if_missing,
+    bool verify_checksum)
+{
+    if (auto crs = map_point_table<Curve>(path, num_points, verify_checksum)) {
+        return crs;
+    }
+    auto crs = build_crs();
+    if (!write_if_missing) {
+        return crs;
+    }
+    if (write_point_table<Curve>(path, crs->get_monomial_points())) {
+        vinfo("wrote ", Curve::name, " point table of size ", crs->get_monomial_size(), " to ", path);
+    } else {
+        vinfo("could not cache ", Curve::name, " point table at ", path);
+    }
+    return crs;
+}
+
+template bool write_point_table<curve::BN254>(const std::filesystem::path&,
+                                              std::span<const curve::BN254::AffineElement>);
+template bool write_point_table<curve::Grumpkin>(const std::filesystem::path&,
+                                                 std::span<const curve::Grumpkin::AffineElement>);
+template std::shared_ptr<factories::ProverCrs<curve::BN254>> map_point_table<curve::BN254>(
+    const std::filesystem::path&, size_t, bool);
+template std::shared_ptr<factories::ProverCrs<curve::Grumpkin>> map_point_table<curve::Grumpkin>(
+    const std::filesystem::path&, size_t, bool);
+template std::shared_ptr<factories::ProverCrs<curve::BN254>> load_or_create_point_table<curve::BN254>(
+    const std::filesystem::path&,
+    size_t,
+    const std::function<std::shared_ptr<factories::ProverCrs<curve::BN254>>()>&,
+    bool,
+    bool);
+template std::shared_ptr<factories::ProverCrs<curve::Grumpkin>> load_or_create_point_table<curve::Grumpkin>(
+    const std::filesystem::path&,
+    size_t,
+    const std::function<std::shared_ptr<factories::ProverCrs<curve::Grumpkin>>()>&,
+    bool,
+    bool);
+
+} // namespace bb::srs
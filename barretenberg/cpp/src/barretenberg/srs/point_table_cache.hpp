@@ -0,0 +1,80 @@
+#pragma once
+#include "barretenberg/srs/factories/crs_factory.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace bb::srs {
+
+/**
+ * @brief Header of an on-disk pippenger point table.
+ * @details The file is this header followed by the 2 * num_points affine elements of the pippenger point table (P_i at
+ * even indices, (\beta * P_i.x, -P_i.y) at odd indices) in their in-memory Montgomery representation, so the payload can
+ * be mapped and handed to pippenger without any conversion. The checksum covers the payload only. As the payload is a
+ * raw memory image the file is only meaningful on a machine with the same endianness as the one that wrote it.
+ */
+struct PointTableHeader {
+    static constexpr uint64_t MAGIC = 0x4c42415450474242ULL; // "BBGPTABL"
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t CURVE_NAME_SIZE = 32;
+
+    uint64_t magic = MAGIC;
+    uint32_t version = VERSION;
+    uint32_t element_size = 0;
+    uint64_t num_points = 0;
+    uint64_t checksum = 0;
+    std::array<char, CURVE_NAME_SIZE> curve_name{};
+};
+static_assert(sizeof(PointTableHeader) == 64, "point table payload must stay 64-byte aligned in the mapping");
+
+/**
+ * @brief Checksum of a point table payload. Computed over fixed-size chunks in parallel and combined in chunk order,
+ * so the result does not depend on the number of threads.
+ */
+uint64_t point_table_checksum(std::span<const uint8_t> data);
+
+/**
+ * @brief Location of the cached point table of a curve inside a CRS directory, e.g. <dir>/bn254_g1_point_table.dat
+ */
+std::filesystem::path point_table_cache_path(const std::filesystem::path& crs_dir, std::string_view curve_name);
+
+/**
+ * @brief Persist a pippenger point table (2 * num_points elements). The file is written to a temporary sibling and
+ * renamed into place, so concurrent readers only ever observe a complete file. Returns false if the file could not be
+ * written.
+ */
+template <typename Curve>
+bool write_point_table(const std::filesystem::path& path, std::span<const typename Curve::AffineElement> point_table);
+
+/**
+ * @brief Map a point table written by write_point_table into memory.
+ * @details Returns nullptr if the file does not exist, was written for a different curve/format, holds fewer than
+ * min_num_points points or has a size that does not match its header. Reading the whole multi-GB payload to check its
+ * checksum would cost as much as the page faults the mapping saves, so that is only done when verify_checksum is set.
+ * The mapping is private but only copied on write, so concurrent bb processes on the same machine share the physical
+ * pages of the table through the page cache.
+ */
+template <typename Curve>
+std::shared_ptr<factories::ProverCrs<Curve>> map_point_table(const std::filesystem::path& path,
+                                                             size_t min_num_points,
+                                                             bool verify_checksum = false);
+
+/**
+ * @brief Map the point table at path if it is usable, otherwise build the prover crs with build_crs and, if
+ * write_if_missing is set, persist its point table for the next run. Failing to persist the table (e.g. read-only CRS
+ * directory) is not an error.
+ */
+template <typename Curve>
+std::shared_ptr<factories::ProverCrs<Curve>> load_or_create_point_table(
+    const std::filesystem::path& path,
+    size_t num_points,
+    const std::function<std::shared_ptr<factories::ProverCrs<Curve>>()>& build_crs,
+    bool write_if_missing = true,
+    bool verify_checksum = false);
+
+} // namespace bb::srs
@@ -0,0 +1,122 @@
+#include "point_table_cache.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace bb;
+
+namespace {
+
+template <typename Curve> std::shared_ptr<srs::factories::ProverCrs<Curve>> random_prover_crs(size_t num_points)
+{
+    std::vector<typename Curve::AffineElement> points(num_points);
+    for (auto& point : points) {
+        point = Curve::AffineElement::random_element();
+    }
+    return std::make_shared<srs::factories::MemProverCrs<Curve>>(points);
+}
+
+class PointTableCacheTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        dir = std::filesystem::temp_directory_path() / ("point_table_cache_test_" + std::to_string(getpid()));
+        std::filesystem::create_directories(dir);
+    }
+    void TearDown() override { std::filesystem::remove_all(dir); }
+
+    std::filesystem::path dir;
+};
+
+} // namespace
+
+TEST_F(PointTableCacheTest, WriteAndMapRoundTrip)
+{
+    const size_t num_points = 100;
+    auto crs = random_prover_crs<curve::BN254>(num_points);
+    auto path = srs::point_table_cache_path(dir, curve::BN254::name);
+    EXPECT_EQ(path.filename(), "bn254_g1_point_table.dat");
+    ASSERT_TRUE(srs::write_point_table<curve::BN254>(path, crs->get_monomial_points()));
+
+    auto mapped = srs::map_point_table<curve::BN254>(path, num_points);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(mapped->get_monomial_size(), num_points);
+    auto expected = crs->get_monomial_points();
+    auto actual = mapped->get_monomial_points();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(actual[i], expected[i]);
+    }
+
+    // Writing to the mapped points only changes a private copy, never the file.
+    actual[0] = actual[2];
+    EXPECT_EQ(mapped->get_monomial_points()[0], expected[2]);
+    auto remapped = srs::map_point_table<curve::BN254>(path, num_points, /*verify_checksum=*/true);
+    ASSERT_NE(remapped, nullptr);
+    EXPECT_EQ(remapped->get_monomial_points()[0], expected[0]);
+
+    // A table with fewer points than requested is not usable.
+    EXPECT_EQ(srs::map_point_table<curve::BN254>(path, num_points + 1), nullptr);
+    // A table written for another curve is not usable.
+    EXPECT_EQ(srs::map_point_table<curve::Grumpkin>(path, 1), nullptr);
+}
+
+TEST_F(PointTableCacheTest, RejectsCorruptedTable)
+{
+    const size_t num_points = 16;
+    auto crs = random_prover_crs<curve::BN254>(num_points);
+    auto path = srs::point_table_cache_path(dir, curve::BN254::name);
+    ASSERT_TRUE(srs::write_point_table<curve::BN254>(path, crs->get_monomial_points()));
+
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(sizeof(srs::PointTableHeader) + 100));
+        file.put(0x5a);
+    }
+    EXPECT_EQ(srs::map_point_table<curve::BN254>(path, num_points, /*verify_checksum=*/true), nullptr);
+    // Only the header and the size are checked by default.
+    EXPECT_NE(srs::map_point_table<curve::BN254>(path, num_points), nullptr);
+
+    // Truncated files are rejected regardless of checksum verification.
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 64);
+    EXPECT_EQ(srs::map_point_table<curve::BN254>(path, 1), nullptr);
+}
+
+TEST_F(PointTableCacheTest, LoadOrCreateBuildsOnce)
+{
+    const size_t num_points = 32;
+    auto path = srs::point_table_cache_path(dir, curve::Grumpkin::name);
+    auto crs = random_prover_crs<curve::Grumpkin>(num_points);
+    size_t num_builds = 0;
+    auto build = [&]() {
+        ++num_builds;
+        return crs;
+    };
+
+    auto first = srs::load_or_create_point_table<curve::Grumpkin>(path, num_points, build);
+    auto second = srs::load_or_create_point_table<curve::Grumpkin>(path, num_points, build);
+    EXPECT_EQ(num_builds, 1);
+    EXPECT_EQ(first, crs);
+    ASSERT_NE(second, crs);
+    ASSERT_EQ(second->get_monomial_size(), num_points);
+    for (size_t i = 0; i < 2 * num_points; ++i) {
+        EXPECT_EQ(second->get_monomial_points()[i], crs->get_monomial_points()[i]);
+    }
+}
+
+TEST_F(PointTableCacheTest, LoadOrCreateOnlyWritesWhenAsked)
+{
+    const size_t num_points = 8;
+    auto path = srs::point_table_cache_path(dir, curve::BN254::name);
+    auto crs = random_prover_crs<curve::BN254>(num_points);
+    auto build = [&]() { return crs; };
+
+    EXPECT_EQ(srs::load_or_create_point_table<curve::BN254>(path, num_points, build, /*write_if_missing=*/false), crs);
+    EXPECT_FALSE(std::filesystem::exists(path));
+    EXPECT_EQ(srs::load_or_create_point_table<curve::BN254>(path, num_points, build), crs);
+    EXPECT_TRUE(std::filesystem::exists(path));
+}
@@ -136,6 +136,57 @@ template <class FF> class GrandProductTests : public testing::Test {
         // Check consistency between locally computed z_perm and the one computed by the prover library
         EXPECT_EQ(prover_polynomials.z_perm, z_permutation_expected);
     };
+
+    /**
+     * @brief Check that restricting the grand product computation to the active ranges of a trace gives the same
+     * z_permutation, for a trace whose wires vanish and whose permutation is trivial outside of those ranges
+     */
+    template <typename Flavor> static void test_permutation_grand_product_with_active_ranges()
+    {
+        using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+        // Large enough to span several threads and tiles
+        static const size_t circuit_size = 1 << 14;
+        const RowRanges active_ranges{ { 1, 100 }, { 5000, 9000 }, { 12000, 12001 } };
+
+        ProverPolynomials prover_polynomials;
+        for (auto& poly : prover_polynomials.get_to_be_shifted()) {
+            poly = Polynomial::random(circuit_size, /*shiftable*/ 1);
+        }
+        for (auto& poly : prover_polynomials.get_all()) {
+            if (poly.is_empty()) {
+                poly = Polynomial::random(circuit_size);
+            }
+        }
+        // Outside of the active ranges, w = 0 and σ = id
+        const RowRanges inactive_ranges = complement_row_ranges(active_ranges, circuit_size);
+        for (auto [wire, sigma, id] :
+             zip_view(prover_polynomials.get_wires(), prover_polynomials.get_sigmas(), prover_polynomials.get_ids())) {
+            for (const auto& [start, end] : inactive_ranges) {
+                for (size_t i = start; i < end; ++i) {
+                    if (i >= wire.start_index()) {
+                        wire.at(i) = FF::zero();
+                    }
+                    sigma.at(i) = id[i];
+                }
+            }
+        }
+
+        RelationParameters<FF> params{
+            .eta = 0,
+            .beta = FF::random_element(),
+            .gamma = FF::random_element(),
+            .public_input_delta = 1,
+            .lookup_grand_product_delta = 1,
+        };
+
+        using GrandProductRelation = typename bb::UltraPermutationRelation<FF>;
+        compute_grand_product<Flavor, GrandProductRelation>(prover_polynomials, params, active_ranges);
+        Polynomial z_permutation = prover_polynomials.z_perm;
+        compute_grand_product<Flavor, GrandProductRelation>(prover_polynomials, params);
+
+        EXPECT_EQ(z_permutation, prover_polynomials.z_perm);
+    };
 };
 
 using FieldTypes = testing::Types<bb::fr>;
@@ -145,3 +196,8 @@ TYPED_TEST(GrandProductTests, GrandProductPermutation)
 {
     TestFixture::template test_permutation_grand_product_construction<UltraFlavor>();
 }
+
+TYPED_TEST(GrandProductTests, GrandProductPermutationWithActiveRanges)
+{
+    TestFixture::template test_permutation_grand_product_with_active_ranges<UltraFlavor>();
+}
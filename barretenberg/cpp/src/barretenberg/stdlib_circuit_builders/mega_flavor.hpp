@@ -153,6 +153,7 @@ class MegaFlavor {
         auto get_sigma_polynomials() { return RefArray{ sigma_1, sigma_2, sigma_3, sigma_4 }; };
         auto get_id_polynomials() { return RefArray{ id_1, id_2, id_3, id_4 }; };
         auto get_table_polynomials() { return RefArray{ table_1, table_2, table_3, table_4 }; };
+        auto get_table_polynomials() const { return RefArray{ table_1, table_2, table_3, table_4 }; };
     };
 
     // Mega needs to expose more public classes than most flavors due to MegaRecursive reuse, but these
@@ -218,6 +219,14 @@ class MegaFlavor {
                 this->return_data,        this->return_data_read_counts,        this->return_data_read_tags
             };
         }
+        auto get_databus_entities() const // Excludes the derived inverse polynomials
+        {
+            return RefArray{
+                this->calldata,           this->calldata_read_counts,           this->calldata_read_tags,
+                this->secondary_calldata, this->secondary_calldata_read_counts, this->secondary_calldata_read_tags,
+                this->return_data,        this->return_data_read_counts,        this->return_data_read_tags
+            };
+        }
 
         auto get_databus_inverses()
         {
@@ -319,6 +328,7 @@ class MegaFlavor {
         auto get_sigmas() { return PrecomputedEntities<DataType>::get_sigma_polynomials(); };
         auto get_ids() { return PrecomputedEntities<DataType>::get_id_polynomials(); };
         auto get_tables() { return PrecomputedEntities<DataType>::get_table_polynomials(); };
+        auto get_tables() const { return PrecomputedEntities<DataType>::get_table_polynomials(); };
         auto get_unshifted()
         {
             return concatenate(PrecomputedEntities<DataType>::get_all(), WitnessEntities<DataType>::get_all());
@@ -505,8 +515,9 @@ class MegaFlavor {
                                                                              this->pub_inputs_offset);
             relation_parameters.public_input_delta = public_input_delta;
 
-            // Compute permutation and lookup grand product polynomials
-            compute_grand_products<MegaFlavor>(this->polynomials, relation_parameters);
+            // Compute permutation and lookup grand product polynomials. Outside of the blocks the wires vanish and
+            // σ = id, so the grand product only needs to be computed over the blocks.
+            compute_grand_products<MegaFlavor>(this->polynomials, relation_parameters, this->active_block_ranges);
         }
     };
 
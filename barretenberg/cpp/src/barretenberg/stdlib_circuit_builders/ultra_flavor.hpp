@@ -153,6 +153,7 @@ class UltraFlavor {
         auto get_sigma_polynomials() { return RefArray{ sigma_1, sigma_2, sigma_3, sigma_4 }; };
         auto get_id_polynomials() { return RefArray{ id_1, id_2, id_3, id_4 }; };
         auto get_table_polynomials() { return RefArray{ table_1, table_2, table_3, table_4 }; };
+        auto get_table_polynomials() const { return RefArray{ table_1, table_2, table_3, table_4 }; };
     };
 
     /**
@@ -240,6 +241,7 @@ class UltraFlavor {
         auto get_sigmas() { return PrecomputedEntities<DataType>::get_sigma_polynomials(); };
         auto get_ids() { return PrecomputedEntities<DataType>::get_id_polynomials(); };
         auto get_tables() { return PrecomputedEntities<DataType>::get_table_polynomials(); };
+        auto get_tables() const { return PrecomputedEntities<DataType>::get_table_polynomials(); };
         auto get_unshifted()
         {
             return concatenate(PrecomputedEntities<DataType>::get_all(), WitnessEntities<DataType>::get_all());
@@ -411,8 +413,9 @@ class UltraFlavor {
                                                                               this->pub_inputs_offset);
             relation_parameters.public_input_delta = public_input_delta;
 
-            // Compute permutation and lookup grand product polynomials
-            compute_grand_products<UltraFlavor>(this->polynomials, relation_parameters);
+            // Compute permutation and lookup grand product polynomials. Outside of the blocks the wires vanish and
+            // σ = id, so the grand product only needs to be computed over the blocks.
+            compute_grand_products<UltraFlavor>(this->polynomials, relation_parameters, this->active_block_ranges);
         }
     };
 
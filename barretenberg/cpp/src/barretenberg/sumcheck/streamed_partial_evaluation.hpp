@@ -0,0 +1,49 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Bound, in bytes, on the memory of the sumcheck book-keeping table (see SumcheckProver); 0 for no bound
+ * @details The default is read from BB_SUMCHECK_MEMORY_BUDGET, in MiB.
+ */
+void set_sumcheck_memory_budget(size_t num_bytes);
+size_t get_sumcheck_memory_budget();
+
+/**
+ * @brief A column of the sumcheck book-keeping table of round r, computed on the fly from the full polynomial
+ * @details Row \f$ \ell \f$ of the table is \f$ P(u_0, \ldots, u_{r-1}, \vec \ell) = \sum_{b} w_b \cdot
+ * P(b + 2^r \ell) \f$ where \f$ w_b = \prod_i (1 - u_i)^{1 - b_i} u_i^{b_i} \f$ for \f$ b \in \{0,1\}^r \f$ are the
+ * weights. Only the rows of the window backed by the polynomial are read.
+ */
+template <typename Polynomial> class StreamedPartialEvaluation {
+  public:
+    using FF = typename Polynomial::FF;
+
+    StreamedPartialEvaluation() = default;
+    StreamedPartialEvaluation(const Polynomial& poly, const std::vector<FF>& weights)
+        : poly(&poly)
+        , weights(&weights)
+    {}
+
+    FF operator[](size_t row) const
+    {
+        const size_t num_weights = weights->size();
+        const size_t window_start = row * num_weights;
+        const size_t start = std::max(window_start, poly->start_index());
+        const size_t end = std::min(window_start + num_weights, poly->end_index());
+        FF result{ 0 };
+        for (size_t i = start; i < end; ++i) {
+            result += (*weights)[i - window_start] * (*poly)[i];
+        }
+        return result;
+    }
+
+  private:
+    const Polynomial* poly = nullptr;
+    const std::vector<FF>* weights = nullptr;
+};
+
+} // namespace bb
@@ -1,7 +1,45 @@
 #include "sumcheck.hpp"
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
 
-// Hack to make the module compile.
+namespace bb {
 
-// TODO(https://github.com/AztecProtocol/barretenberg/issues/1102): this makes the module not empty (note the comment
-// above pre-existed)
-void fixme_compile_hack() {}
\ No newline at end of file
+namespace {
+/**
+ * @brief The budget in BB_SUMCHECK_MEMORY_BUDGET, in MiB; 0 (no budget) if it is unset or not a number of MiB
+ * @details This runs during static initialization, so an invalid value is reported rather than thrown.
+ */
+size_t default_sumcheck_memory_budget()
+{
+    const char* env = std::getenv("BB_SUMCHECK_MEMORY_BUDGET");
+    if (env == nullptr || *env == '\0') {
+        return 0;
+    }
+    const char* end = env + std::strlen(env);
+    size_t num_mib = 0;
+    auto result = std::from_chars(env, end, num_mib);
+    if (result.ec != std::errc() || result.ptr != end || num_mib > (std::numeric_limits<size_t>::max() >> 20)) {
+        std::cerr << "Ignoring BB_SUMCHECK_MEMORY_BUDGET=" << env << ", expected a number of MiB" << std::endl;
+        return 0;
+    }
+    return num_mib << 20;
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+size_t sumcheck_memory_budget = default_sumcheck_memory_budget();
+} // namespace
+
+void set_sumcheck_memory_budget(size_t num_bytes)
+{
+    sumcheck_memory_budget = num_bytes;
+}
+
+size_t get_sumcheck_memory_budget()
+{
+    return sumcheck_memory_budget;
+}
+
+} // namespace bb
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/plonk_honk_shared/library/grand_product_delta.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include "barretenberg/sumcheck/streamed_partial_evaluation.hpp"
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
@@ -77,6 +78,13 @@ After computing the last challenge \f$ u_{d-1} \f$ in Round \f$ d-1 \f$ and upda
 \f$P_1(u_0,\ldots, u_{d-1}), \ldots, P_N(u_0,\ldots, u_{d-1})\f$ and concatenates these values with the last challenge
 to the transcript.
 
+### Memory-Bounded Mode
+The book-keeping table adds half the size of the prover polynomials to the peak memory. Given a memory budget (see \ref
+bb::set_sumcheck_memory_budget "set_sumcheck_memory_budget"), the first \f$ k \f$ rounds are instead run over
+\ref bb::StreamedPartialEvaluation "streamed partial evaluations" of \p full_polynomials, which recompute each row
+\f$ P_j(u_0,\ldots, u_{i-1}, \vec \ell) \f$ from \f$ 2^i \f$ rows of \f$ P_j \f$. The table is materialized after round
+\f$ k - 1 \f$ with \f$ 2^{d-k} \f$ rows, \f$ k \f$ being the least number of rounds for which it fits the budget.
+
 ## Round Univariates
 
 \subsubsection SumcheckProverContributionsofPow Contributions of GateSeparatorPolynomial
@@ -120,6 +128,8 @@ template <typename Flavor> class SumcheckProver {
     using FF = typename Flavor::FF;
     using ProverPolynomials = typename Flavor::ProverPolynomials;
     using PartiallyEvaluatedMultivariates = typename Flavor::PartiallyEvaluatedMultivariates;
+    using StreamedMultivariates =
+        typename Flavor::template AllEntities<StreamedPartialEvaluation<typename Flavor::Polynomial>>;
     using ClaimedEvaluations = typename Flavor::AllValues;
 
     using Transcript = typename Flavor::Transcript;
@@ -169,13 +179,42 @@ template <typename Flavor> class SumcheckProver {
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+    /**
+     * @brief The number of rounds run over streamed partial evaluations of the full polynomials, before
+     * #partially_evaluated_polynomials is materialized; 1 unless a memory budget is set.
+     */
+    size_t num_streamed_rounds;
+    // Weights of the rows of the full polynomials in the streamed partial evaluations
+    std::vector<FF> streamed_weights{ FF(1) };
+
     // prover instantiates sumcheck with circuit size and a prover transcript
-    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
+    SumcheckProver(size_t multivariate_n,
+                   const std::shared_ptr<Transcript>& transcript,
+                   size_t memory_budget = get_sumcheck_memory_budget())
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
         , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , num_streamed_rounds(compute_num_streamed_rounds(multivariate_n, memory_budget))
+    {
+        if (num_streamed_rounds == 1) {
+            partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(multivariate_n);
+        }
+    };
+
+    /**
+     * @brief The least number of rounds (at least 1) after which the book-keeping table fits the memory budget
+     */
+    static size_t compute_num_streamed_rounds(size_t multivariate_n, size_t memory_budget)
+    {
+        const size_t max_num_rounds = std::max(numeric::get_msb(multivariate_n), static_cast<size_t>(1));
+        size_t num_rounds = 1;
+        while (memory_budget > 0 && num_rounds < max_num_rounds &&
+               Flavor::NUM_ALL_ENTITIES * (multivariate_n >> num_rounds) * sizeof(FF) > memory_budget) {
+            num_rounds++;
+        }
+        return num_rounds;
+    }
 
     /**
      * @brief Compute round univariate, place it in transcript, compute challenge, partially evaluate. Repeat
@@ -185,13 +224,21 @@ template <typename Flavor> class SumcheckProver {
      * @param relation_parameters
      * @param alpha Batching challenge for subrelations.
      * @param gate_challenges
+     * @param active_ranges Rows outside of which all relations vanish (see DeciderProvingKey_::get_active_row_ranges),
+     * their edges are skipped in every round; empty if all rows are active. Ignored for ZK flavors, whose masking makes
+     * every edge contribute.
      * @return SumcheckOutput
      */
     SumcheckOutput<Flavor> prove(ProverPolynomials& full_polynomials,
                                  const bb::RelationParameters<FF>& relation_parameters,
                                  const RelationSeparator alpha,
-                                 const std::vector<FF>& gate_challenges)
+                                 const std::vector<FF>& gate_challenges,
+                                 const RowRanges& active_ranges = {})
     {
+        if constexpr (!Flavor::HasZK) {
+            round.active_ranges = active_ranges;
+        }
+
         // In case the Flavor has ZK, we populate sumcheck data structure with randomness, compute correcting term for
         // the total sum, etc.
         if constexpr (Flavor::HasZK) {
@@ -217,12 +264,17 @@ template <typename Flavor> class SumcheckProver {
             FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+            if (num_streamed_rounds == 1) {
+                partially_evaluate(full_polynomials, multivariate_n, round_challenge);
+            } else {
+                partially_evaluate_streamed(full_polynomials, round_idx, round_challenge);
+            }
             // Prepare ZK Sumcheck data for the next round
             if constexpr (Flavor::HasZK) {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
             };
             gate_separators.partially_evaluate(round_challenge);
+            round.active_ranges = fold_row_ranges(round.active_ranges);
             round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
                                                       // release memory?        // All but final round
                                                       // We operate on partially_evaluated_polynomials in place.
@@ -233,24 +285,39 @@ template <typename Flavor> class SumcheckProver {
             PROFILE_THIS_NAME("sumcheck loop");
 
             // Write the round univariate to the transcript
-            round_univariate = round.compute_univariate(round_idx,
-                                                        partially_evaluated_polynomials,
-                                                        relation_parameters,
-                                                        gate_separators,
-                                                        alpha,
-                                                        zk_sumcheck_data);
+            if (round_idx < num_streamed_rounds) {
+                StreamedMultivariates streamed_polynomials = get_streamed_polynomials(full_polynomials);
+                round_univariate = round.compute_univariate(round_idx,
+                                                            streamed_polynomials,
+                                                            relation_parameters,
+                                                            gate_separators,
+                                                            alpha,
+                                                            zk_sumcheck_data);
+            } else {
+                round_univariate = round.compute_univariate(round_idx,
+                                                            partially_evaluated_polynomials,
+                                                            relation_parameters,
+                                                            gate_separators,
+                                                            alpha,
+                                                            zk_sumcheck_data);
+            }
             // Place evaluations of Sumcheck Round Univariate in the transcript
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
             FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
+            if (round_idx < num_streamed_rounds) {
+                partially_evaluate_streamed(full_polynomials, round_idx, round_challenge);
+            } else {
+                partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
+            }
             // Prepare evaluation masking and libra structures for the next round (for ZK Flavors)
             if constexpr (Flavor::HasZK) {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
             };
 
             gate_separators.partially_evaluate(round_challenge);
+            round.active_ranges = fold_row_ranges(round.active_ranges);
             round.round_size = round.round_size >> 1;
             vinfo("completed sumcheck round ", round_idx);
         }
@@ -332,9 +399,7 @@ template <typename Flavor> class SumcheckProver {
         auto poly_view = polynomials.get_all();
         // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(poly_view.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j].at(i >> 1) = poly_view[j][i] + round_challenge * (poly_view[j][i + 1] - poly_view[j][i]);
-            }
+            partially_evaluate_column(poly_view[j], pep_view[j], round_size, round_challenge);
         });
     };
     /**
@@ -347,13 +412,73 @@ template <typename Flavor> class SumcheckProver {
         auto pep_view = partially_evaluated_polynomials.get_all();
         // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(polynomials.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j].at(i >> 1) =
-                    polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
-            }
+            partially_evaluate_column(polynomials[j], pep_view[j], round_size, round_challenge);
         });
     };
 
+    /**
+     * @brief Partially evaluate at the challenge of a streamed round: fold the challenge into the weights of the
+     * streamed partial evaluations and, after the last streamed round, materialize the book-keeping table
+     * @param full_polynomials
+     * @param round_idx \f$i < \f$ #num_streamed_rounds
+     * @param round_challenge \f$u_i\f$
+     */
+    void partially_evaluate_streamed(ProverPolynomials& full_polynomials, size_t round_idx, const FF& round_challenge)
+    {
+        // w_{b + 2^i b_i} = w_b * ((1 - u_i)^{1 - b_i} u_i^{b_i})
+        const size_t num_weights = streamed_weights.size();
+        streamed_weights.resize(2 * num_weights);
+        for (size_t b = 0; b < num_weights; ++b) {
+            streamed_weights[b + num_weights] = streamed_weights[b] * round_challenge;
+            streamed_weights[b] -= streamed_weights[b + num_weights];
+        }
+        if (round_idx + 1 < num_streamed_rounds) {
+            return;
+        }
+        PROFILE_THIS_NAME("materialize partially evaluated polynomials");
+        const size_t table_size = multivariate_n >> num_streamed_rounds;
+        partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(2 * table_size);
+        StreamedMultivariates streamed_polynomials = get_streamed_polynomials(full_polynomials);
+        auto pep_view = partially_evaluated_polynomials.get_all();
+        auto streamed_view = streamed_polynomials.get_all();
+        parallel_for(pep_view.size(), [&](size_t j) {
+            for (size_t row = 0; row < table_size; ++row) {
+                pep_view[j].at(row) = streamed_view[j][row];
+            }
+        });
+    }
+
+    StreamedMultivariates get_streamed_polynomials(ProverPolynomials& full_polynomials)
+    {
+        StreamedMultivariates result;
+        for (auto [streamed, poly] : zip_view(result.get_all(), full_polynomials.get_all())) {
+            streamed = StreamedPartialEvaluation<typename Flavor::Polynomial>(poly, streamed_weights);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Fold a single column: result[i/2] = poly[i] + u * (poly[i+1] - poly[i]) for even i < round_size.
+     * @details The differences are gathered into a small tile so that the multiplications by the round challenge go
+     * through the batched field kernel (see \ref bb::field::mul_batch "field::mul_batch"). `poly` and `result` may be
+     * the same polynomial, since the write to index i/2 never overtakes the reads of indices i, i+1.
+     */
+    static void partially_evaluate_column(const auto& poly, auto& result, size_t round_size, const FF& round_challenge)
+    {
+        constexpr size_t TILE_SIZE = 64;
+        std::array<FF, TILE_SIZE> tile;
+        for (size_t i = 0; i < round_size; i += 2 * TILE_SIZE) {
+            const size_t tile_size = std::min(TILE_SIZE, (round_size - i) >> 1);
+            for (size_t k = 0; k < tile_size; ++k) {
+                tile[k] = poly[i + 2 * k + 1] - poly[i + 2 * k];
+            }
+            FF::mul_batch(std::span<const FF>{ tile.data(), tile_size }, round_challenge, { tile.data(), tile_size });
+            for (size_t k = 0; k < tile_size; ++k) {
+                result.at((i >> 1) + k) = poly[i + 2 * k] + tile[k];
+            }
+        }
+    }
+
     /**
     * @brief This method takes the book-keeping table containing partially evaluated prover polynomials and creates a
     * vector containing the evaluations of all prover polynomials at the point \f$ (u_0, \ldots, u_{d-1} )\f$.
@@ -161,6 +161,45 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    /**
+     * @brief Check that streaming the first rounds under a memory budget yields the same proof
+     */
+    void test_streamed_prover()
+    {
+        const size_t multivariate_d(4);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        std::vector<Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (auto& poly : random_polynomials) {
+            poly = random_poly(multivariate_n);
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+        auto prove = [&](size_t memory_budget, size_t expected_num_streamed_rounds) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript, memory_budget);
+            EXPECT_EQ(sumcheck.num_streamed_rounds, expected_num_streamed_rounds);
+
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < gate_challenges.size(); idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            sumcheck.prove(full_polynomials, {}, alpha, gate_challenges);
+            return transcript->proof_data;
+        };
+
+        auto expected_proof = prove(0, 1);
+        // The book-keeping table fits the budget after two rounds
+        EXPECT_EQ(prove(NUM_POLYNOMIALS * (multivariate_n >> 2) * sizeof(FF), 2), expected_proof);
+        // All rounds are streamed
+        EXPECT_EQ(prove(1, multivariate_d), expected_proof);
+    }
+
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
     void test_prover_verifier_flow()
     {
@@ -345,6 +384,12 @@ TYPED_TEST(SumcheckTests, Prover)
 {
     this->test_prover();
 }
+// Test the memory-bounded prover; the ZK masking is random so the proofs are not comparable
+TYPED_TEST(SumcheckTests, StreamedProver)
+{
+    SKIP_IF_ZK();
+    this->test_streamed_prover();
+}
 // Tests the prover-verifier flow
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/honk/proof_system/active_ranges.hpp"
 #include "barretenberg/polynomials/gate_separator.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/relation_types.hpp"
@@ -44,6 +45,11 @@ template <typename Flavor> class SumcheckProverRound {
      * @brief In Round \f$i = 0,\ldots, d-1\f$, equals \f$2^{d-i}\f$.
      */
     size_t round_size;
+    /**
+     * @brief Rows of this round outside of which every relation vanishes, so that their edges can be skipped; empty if
+     * all rows are active
+     */
+    RowRanges active_ranges;
     /**
      * @brief Number of batched sub-relations in \f$F\f$ specified by Flavor.
      *
@@ -168,13 +174,20 @@ template <typename Flavor> class SumcheckProverRound {
     {
         PROFILE_THIS_NAME("compute_univariate");
 
+        // Only the edges touching an active row contribute to the round univariate
+        const RowRanges edge_ranges = active_ranges.empty() ? RowRanges{ { 0, round_size } }
+                                                            : row_ranges_to_edge_ranges(active_ranges, round_size);
+        size_t num_active_rows = 0;
+        for (const auto& [start, end] : edge_ranges) {
+            num_active_rows += end - start;
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+        size_t num_threads = bb::calculate_num_threads(num_active_rows, min_iterations_per_thread);
+        const size_t num_edges = num_active_rows / 2;
 
         // Construct univariate accumulator containers; one per thread
         std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
@@ -188,24 +201,35 @@ template <typename Flavor> class SumcheckProverRound {
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                if constexpr (!Flavor::HasZK) {
-                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-                } else {
-                    extend_edges_with_masking(extended_edges[thread_idx], polynomials, edge_idx, zk_sumcheck_data);
+            // Each thread gets an equal share of the active edges, counted across the ranges
+            size_t first_edge = thread_idx * num_edges / num_threads;
+            const size_t last_edge = (thread_idx + 1) * num_edges / num_threads;
+            size_t range_first_edge = 0;
+            for (const auto& [range_start, range_end] : edge_ranges) {
+                const size_t range_last_edge = range_first_edge + (range_end - range_start) / 2;
+                if (first_edge < last_edge && first_edge < range_last_edge) {
+                    const size_t start = range_start + 2 * (first_edge - range_first_edge);
+                    const size_t end = range_start + 2 * (std::min(last_edge, range_last_edge) - range_first_edge);
+                    for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
+                        if constexpr (!Flavor::HasZK) {
+                            extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+                        } else {
+                            extend_edges_with_masking(
+                                extended_edges[thread_idx], polynomials, edge_idx, zk_sumcheck_data);
+                        }
+                        // Compute the \f$ \ell \f$-th edge's univariate contribution,
+                        // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators
+                        // for \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
+                        // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
+                        // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+                        accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                        extended_edges[thread_idx],
+                                                        relation_parameters,
+                                                        gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
+                    }
+                    first_edge = std::min(last_edge, range_last_edge);
                 }
-                // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
-                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
-                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
-                // \beta_{d-1}^{\ell_{d-1}}\f$.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
+                range_first_edge = range_last_edge;
             }
         });
 
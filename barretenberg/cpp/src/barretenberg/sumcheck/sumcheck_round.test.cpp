@@ -131,3 +131,24 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+/**
+ * @brief Check the bookkeeping of the active row ranges through the sumcheck rounds
+ */
+TEST(SumcheckRound, ActiveRowRanges)
+{
+    // Empty ranges are dropped, overlapping and touching ones merged
+    RowRanges ranges = normalize_row_ranges({ { 10, 12 }, { 3, 3 }, { 1, 5 }, { 5, 7 }, { 11, 20 } });
+    EXPECT_EQ(ranges, (RowRanges{ { 1, 7 }, { 10, 20 } }));
+
+    // An edge is active if either of its rows is
+    EXPECT_EQ(row_ranges_to_edge_ranges(ranges, 32), (RowRanges{ { 0, 8 }, { 10, 20 } }));
+    EXPECT_EQ(row_ranges_to_edge_ranges({ { 3, 4 }, { 5, 6 }, { 31, 32 } }, 32), (RowRanges{ { 2, 6 }, { 30, 32 } }));
+
+    // Row i of the next round is active if either of rows 2i, 2i + 1 is
+    ranges = fold_row_ranges(ranges);
+    EXPECT_EQ(ranges, (RowRanges{ { 0, 4 }, { 5, 10 } }));
+    ranges = fold_row_ranges(ranges);
+    EXPECT_EQ(ranges, (RowRanges{ { 0, 5 } }));
+    EXPECT_TRUE(fold_row_ranges({}).empty());
+}
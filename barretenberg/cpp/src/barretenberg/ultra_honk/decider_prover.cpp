@@ -36,7 +36,8 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
         sumcheck_output = sumcheck.prove(proving_key->proving_key.polynomials,
                                          proving_key->relation_parameters,
                                          proving_key->alphas,
-                                         proving_key->gate_challenges);
+                                         proving_key->gate_challenges,
+                                         proving_key->get_active_row_ranges());
     }
 }
 
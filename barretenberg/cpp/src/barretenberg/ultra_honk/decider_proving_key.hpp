@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/execution_trace/execution_trace.hpp"
 #include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/honk/proof_system/active_ranges.hpp"
 #include "barretenberg/plonk_honk_shared/arithmetization/mega_arithmetization.hpp"
 #include "barretenberg/plonk_honk_shared/arithmetization/ultra_arithmetization.hpp"
 #include "barretenberg/plonk_honk_shared/composer/composer_lib.hpp"
@@ -309,6 +310,38 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
 
     bool get_is_structured() { return is_structured; }
 
+    /**
+     * @brief Rows of a structured trace outside of which every relation vanishes, empty if the trace is not structured
+     * @details Between the active parts of the blocks the wires and selectors are zero, sigma equals id so that z_perm
+     * is constant, and the lookup and databus polynomials are zero. Every relation is then satisfied identically on
+     * (partial evaluations of) such rows, so sumcheck can skip them. The remaining rows are the blocks, the lagrange
+     * polynomials, the lookup tables with their read counts and tags and the databus columns.
+     */
+    RowRanges get_active_row_ranges() const
+    {
+        if (!is_structured) {
+            return {};
+        }
+        RowRanges ranges = proving_key.active_block_ranges;
+        auto add_backing_range = [&](const Polynomial& poly) {
+            ranges.emplace_back(poly.start_index(), poly.end_index());
+        };
+        const auto& polynomials = proving_key.polynomials;
+        add_backing_range(polynomials.lagrange_first);
+        add_backing_range(polynomials.lagrange_last);
+        add_backing_range(polynomials.lookup_read_counts);
+        add_backing_range(polynomials.lookup_read_tags);
+        for (const auto& table : polynomials.get_tables()) {
+            add_backing_range(table);
+        }
+        if constexpr (HasDataBus<Flavor>) {
+            for (const auto& poly : polynomials.get_databus_entities()) {
+                add_backing_range(poly);
+            }
+        }
+        return normalize_row_ranges(std::move(ranges));
+    }
+
   private:
     static constexpr size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
     static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
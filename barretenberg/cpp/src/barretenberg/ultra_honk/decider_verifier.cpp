@@ -35,6 +35,22 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify_proof(const Dec
  *
  */
 template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
+{
+    const auto pairing_points = reduce_to_pairing_points();
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return pcs_verification_key->pairing_check((*pairing_points)[0], (*pairing_points)[1]);
+}
+
+/**
+ * @brief Run the decider verifier up to, but excluding, the final pairing check
+ * @details Lets the caller defer the pairing check, e.g. to batch the checks of many proofs into one (see
+ * VerifierCommitmentKey::batch_pairing_check).
+ * @return The pairing points (P₀, P₁) to be checked, or std::nullopt if sumcheck did not verify
+ */
+template <typename Flavor>
+std::optional<typename DeciderVerifier_<Flavor>::PairingPoints> DeciderVerifier_<Flavor>::reduce_to_pairing_points()
 {
     using PCS = typename Flavor::PCS;
     using Curve = typename Flavor::Curve;
@@ -50,9 +66,9 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
         sumcheck.verify(accumulator->relation_parameters, accumulator->alphas, accumulator->gate_challenges);
 
     // If Sumcheck did not verify, return false
-    if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
+    if (!sumcheck_verified.has_value() || !sumcheck_verified.value()) {
         info("Sumcheck verification failed.");
-        return false;
+        return std::nullopt;
     }
 
     const auto opening_claim = Shplemini::compute_batch_opening_claim(accumulator->verification_key->circuit_size,
@@ -63,10 +79,7 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
                                                                       multivariate_challenge,
                                                                       Commitment::one(),
                                                                       transcript);
-    const auto pairing_points = PCS::reduce_verify_batch_opening_claim(opening_claim, transcript);
-    bool verified = pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
-
-    return sumcheck_verified.value() && verified;
+    return PCS::reduce_verify_batch_opening_claim(opening_claim, transcript);
 }
 
 template class DeciderVerifier_<UltraFlavor>;
@@ -14,6 +14,7 @@ template <typename Flavor> class DeciderVerifier_ {
     using Transcript = typename Flavor::Transcript;
     using DeciderVerificationKey = DeciderVerificationKey_<Flavor>;
     using DeciderProof = std::vector<FF>;
+    using PairingPoints = typename Flavor::PCS::VerifierAccumulator;
 
   public:
     explicit DeciderVerifier_();
@@ -30,6 +31,7 @@ template <typename Flavor> class DeciderVerifier_ {
 
     bool verify_proof(const DeciderProof&); // used when a decider proof is known explicitly
     bool verify();                          // used when transcript that has been initialized with a proof
+    std::optional<PairingPoints> reduce_to_pairing_points();
     std::shared_ptr<VerificationKey> key;
     std::map<std::string, Commitment> commitments;
     std::shared_ptr<DeciderVerificationKey> accumulator;
@@ -104,12 +104,12 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
             witness_commitments.w_o = proving_key->proving_key.commitment_key->commit_structured(
                 proving_key->proving_key.polynomials.w_o, proving_key->proving_key.active_block_ranges);
         } else {
-            witness_commitments.w_l =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_l);
-            witness_commitments.w_r =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_r);
-            witness_commitments.w_o =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_o);
+            auto& polynomials = proving_key->proving_key.polynomials;
+            auto commitments = proving_key->proving_key.commitment_key->batch_commit(
+                RefArray{ polynomials.w_l, polynomials.w_r, polynomials.w_o });
+            witness_commitments.w_l = commitments[0];
+            witness_commitments.w_r = commitments[1];
+            witness_commitments.w_o = commitments[2];
         }
     }
 
@@ -121,26 +121,20 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
 
     if constexpr (IsGoblinFlavor<Flavor>) {
 
-        // Commit to Goblin ECC op wires
-        for (auto [commitment, polynomial, label] : zip_view(witness_commitments.get_ecc_op_wires(),
-                                                             proving_key->proving_key.polynomials.get_ecc_op_wires(),
-                                                             commitment_labels.get_ecc_op_wires())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
-                commitment = proving_key->proving_key.commitment_key->commit(polynomial);
+        // Commit to Goblin ECC op wires and DataBus related polynomials together
+        auto& polynomials = proving_key->proving_key.polynomials;
+        auto commitments =
+            concatenate(witness_commitments.get_ecc_op_wires(), witness_commitments.get_databus_entities());
+        auto labels = concatenate(commitment_labels.get_ecc_op_wires(), commitment_labels.get_databus_entities());
+        {
+            PROFILE_THIS_NAME("COMMIT::ecc_op_wires_and_databus");
+            auto computed_commitments = proving_key->proving_key.commitment_key->batch_commit(
+                concatenate(polynomials.get_ecc_op_wires(), polynomials.get_databus_entities()));
+            for (auto [commitment, computed_commitment] : zip_view(commitments, computed_commitments)) {
+                commitment = computed_commitment;
             }
-            transcript->send_to_verifier(domain_separator + label, commitment);
         }
-
-        // Commit to DataBus related polynomials
-        for (auto [commitment, polynomial, label] :
-             zip_view(witness_commitments.get_databus_entities(),
-                      proving_key->proving_key.polynomials.get_databus_entities(),
-                      commitment_labels.get_databus_entities())) {
-            {
-                PROFILE_THIS_NAME("COMMIT::databus");
-                commitment = proving_key->proving_key.commitment_key->commit(polynomial);
-            }
+        for (auto [commitment, label] : zip_view(commitments, labels)) {
             transcript->send_to_verifier(domain_separator + label, commitment);
         }
     }
@@ -165,10 +159,11 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
     // Commit to lookup argument polynomials and the finalized (i.e. with memory records) fourth wire polynomial
     {
         PROFILE_THIS_NAME("COMMIT::lookup_counts_tags");
-        witness_commitments.lookup_read_counts =
-            proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.lookup_read_counts);
-        witness_commitments.lookup_read_tags =
-            proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.lookup_read_tags);
+        auto& polynomials = proving_key->proving_key.polynomials;
+        auto commitments = proving_key->proving_key.commitment_key->batch_commit(
+            RefArray{ polynomials.lookup_read_counts, polynomials.lookup_read_tags });
+        witness_commitments.lookup_read_counts = commitments[0];
+        witness_commitments.lookup_read_tags = commitments[1];
     }
     {
         PROFILE_THIS_NAME("COMMIT::wires");
@@ -124,6 +124,32 @@ TYPED_TEST(UltraHonkTests, PublicInputs)
     TestFixture::prove_and_verify(builder, /*expected_result=*/true);
 }
 
+/**
+ * @brief Test verifying several proofs, some sharing a verification key, with a single batched pairing check
+ *
+ */
+TYPED_TEST(UltraHonkTests, BatchVerify)
+{
+    std::vector<std::shared_ptr<typename TestFixture::VerificationKey>> verification_keys;
+    std::vector<HonkProof> proofs;
+    for (size_t num_gates : { 10UL, 10UL, 100UL }) {
+        auto builder = UltraCircuitBuilder();
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, /*num_gates=*/4);
+        MockCircuits::add_arithmetic_gates(builder, num_gates);
+
+        auto proving_key = std::make_shared<typename TestFixture::DeciderProvingKey>(builder);
+        typename TestFixture::Prover prover(proving_key);
+        verification_keys.emplace_back(
+            std::make_shared<typename TestFixture::VerificationKey>(proving_key->proving_key));
+        proofs.emplace_back(prover.construct_proof());
+    }
+    EXPECT_TRUE(TestFixture::Verifier::batch_verify_proofs(verification_keys, proofs));
+
+    // Checking a proof against the verification key of a different circuit fails the whole batch
+    std::swap(verification_keys[1], verification_keys[2]);
+    EXPECT_FALSE(TestFixture::Verifier::batch_verify_proofs(verification_keys, proofs));
+}
+
 TYPED_TEST(UltraHonkTests, XorConstraint)
 {
     auto circuit_builder = UltraCircuitBuilder();
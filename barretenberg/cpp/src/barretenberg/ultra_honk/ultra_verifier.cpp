@@ -1,4 +1,5 @@
 #include "./ultra_verifier.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/oink_verifier.hpp"
@@ -10,6 +11,23 @@ namespace bb {
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof)
+{
+    const auto pairing_points = reduce_to_pairing_points(proof);
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return verification_key->verification_key->pcs_verification_key->pairing_check((*pairing_points)[0],
+                                                                                     (*pairing_points)[1]);
+}
+
+/**
+ * @brief Verify an Ultra Honk proof up to, but excluding, the final pairing check
+ *
+ * @return The pairing points to be checked, or std::nullopt if the proof was already found invalid
+ */
+template <typename Flavor>
+std::optional<typename UltraVerifier_<Flavor>::PairingPoints> UltraVerifier_<Flavor>::reduce_to_pairing_points(
+    const HonkProof& proof)
 {
     using FF = typename Flavor::FF;
 
@@ -24,7 +42,43 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
 
     DeciderVerifier decider_verifier{ verification_key, transcript };
 
-    return decider_verifier.verify();
+    return decider_verifier.reduce_to_pairing_points();
+}
+
+/**
+ * @brief Verify many independent Ultra Honk proofs with a single pairing check
+ * @details The proofs are reduced to their pairing points in parallel and the pairing checks are deferred and batched
+ * by VerifierCommitmentKey::batch_pairing_check, so that the cost of the pairings does not grow with the number of
+ * proofs. The verification keys may be shared between proofs.
+ *
+ * @param verification_keys The verification key of each proof
+ * @param proofs The proofs
+ * @return true if all proofs verify
+ */
+template <typename Flavor>
+bool UltraVerifier_<Flavor>::batch_verify_proofs(std::span<const std::shared_ptr<VerificationKey>> verification_keys,
+                                                 std::span<const HonkProof> proofs)
+{
+    ASSERT(verification_keys.size() == proofs.size());
+    if (proofs.empty()) {
+        return true;
+    }
+
+    std::vector<PairingPoints> pairing_points(proofs.size());
+    std::vector<uint8_t> reduced(proofs.size(), 0);
+    parallel_for(proofs.size(), [&](size_t i) {
+        UltraVerifier_ verifier{ verification_keys[i] };
+        auto proof_pairing_points = verifier.reduce_to_pairing_points(proofs[i]);
+        if (proof_pairing_points.has_value()) {
+            pairing_points[i] = *proof_pairing_points;
+            reduced[i] = 1;
+        }
+    });
+    if (std::find(reduced.begin(), reduced.end(), 0) != reduced.end()) {
+        return false;
+    }
+
+    return verification_keys[0]->pcs_verification_key->batch_pairing_check(pairing_points);
 }
 
 template class UltraVerifier_<UltraFlavor>;
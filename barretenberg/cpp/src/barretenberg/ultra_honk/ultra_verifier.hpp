@@ -16,6 +16,7 @@ template <typename Flavor> class UltraVerifier_ {
     using Transcript = typename Flavor::Transcript;
     using DeciderVK = DeciderVerificationKey_<Flavor>;
     using DeciderVerifier = DeciderVerifier_<Flavor>;
+    using PairingPoints = typename DeciderVerifier::PairingPoints;
 
   public:
     explicit UltraVerifier_(const std::shared_ptr<VerificationKey>& verifier_key)
@@ -23,6 +24,10 @@ template <typename Flavor> class UltraVerifier_ {
     {}
 
     bool verify_proof(const HonkProof& proof);
+    std::optional<PairingPoints> reduce_to_pairing_points(const HonkProof& proof);
+
+    static bool batch_verify_proofs(std::span<const std::shared_ptr<VerificationKey>> verification_keys,
+                                    std::span<const HonkProof> proofs);
 
     std::shared_ptr<Transcript> transcript{ nullptr };
     std::shared_ptr<DeciderVK> verification_key;
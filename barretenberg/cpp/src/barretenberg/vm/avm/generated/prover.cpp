@@ -4,6 +4,7 @@
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/commitment_schemes/shplonk/shplemini.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/task_group.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/honk/proof_system/logderivative_library.hpp"
 #include "barretenberg/honk/proof_system/permutation_library.hpp"
@@ -52,8 +53,9 @@ void AvmProver::execute_wire_commitments_round()
     // logderivative phase)
     auto wire_polys = prover_polynomials.get_wires();
     auto labels = commitment_labels.get_wires();
+    auto commitments = commitment_key->batch_commit(wire_polys);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key->commit_sparse(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], commitments[idx]);
     }
 }
 
@@ -62,18 +64,19 @@ void AvmProver::execute_log_derivative_inverse_round()
     auto [beta, gamma] = transcript->template get_challenges<FF>("beta", "gamma");
     relation_parameters.beta = beta;
     relation_parameters.gamma = gamma;
-    std::vector<std::function<void()>> tasks;
 
+    // The lookups vary a lot in cost; as tasks of a TaskGroup they can themselves run parallel code, which keeps the
+    // cores busy once the cheap ones are done
+    TaskGroup tasks;
     bb::constexpr_for<0, std::tuple_size_v<Flavor::LookupRelations>, 1>([&]<size_t relation_idx>() {
         using Relation = std::tuple_element_t<relation_idx, Flavor::LookupRelations>;
-        tasks.push_back([&]() {
+        tasks.run([&]() {
             AVM_TRACK_TIME(std::string("prove/execute_log_derivative_inverse_round/") + Relation::NAME,
                            (compute_logderivative_inverse<Flavor, Relation>(
                                prover_polynomials, relation_parameters, key->circuit_size)));
         });
     });
-
-    bb::parallel_for(tasks.size(), [&](size_t i) { tasks[i](); });
+    tasks.wait();
 }
 
 void AvmProver::execute_log_derivative_inverse_commitments_round()
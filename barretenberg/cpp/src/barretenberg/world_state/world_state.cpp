@@ -23,6 +23,7 @@
 #include <optional>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -427,83 +428,390 @@ WorldStateStatus WorldState::sync_block(
     }
     rollback();
 
+    // Every tree is committed as soon as its own updates are done and its snapshot matches the block's, so the LMDB
+    // writes of the quicker trees overlap the hashing of the slower ones. The archive, which our block height is read
+    // from, is only committed once all the others have been.
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
-    Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+    const std::vector<MerkleTreeId> state_tree_ids{
+        MerkleTreeId::NULLIFIER_TREE,
+        MerkleTreeId::NOTE_HASH_TREE,
+        MerkleTreeId::PUBLIC_DATA_TREE,
+        MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+    };
+    Signal signal(static_cast<uint32_t>(state_tree_ids.size()) + 1);
     std::atomic_bool success = true;
     std::string err_message;
-    auto decr = [&signal, &success, &err_message](const auto& resp) {
+    std::mutex committed_mutex;
+    // the block height of each tree we have committed, before its commit
+    std::unordered_map<MerkleTreeId, uint64_t> committed_block_heights;
+
+    auto fail = [&signal, &success, &err_message](const std::string& message) {
         // take the first error
         bool expected = true;
-        if (!resp.success && success.compare_exchange_strong(expected, false)) {
-            err_message = resp.message;
+        if (success.compare_exchange_strong(expected, false)) {
+            err_message = message;
         }
-
         signal.signal_decrement();
     };
 
+    auto verify_and_commit = [&](MerkleTreeId id) {
+        std::visit(
+            [&, id](auto&& wrapper) {
+                auto* tree = wrapper.tree.get();
+                tree->get_meta_data(true, [&, id, tree](const TypedResponse<TreeMetaResponse>& response) {
+                    if (!response.success) {
+                        fail(response.message);
+                        return;
+                    }
+                    const TreeMeta& meta = response.inner.meta;
+                    auto expected = block_state_ref.find(id);
+                    if (expected == block_state_ref.end() ||
+                        expected->second != TreeStateReference(meta.root, meta.size)) {
+                        fail("Can't synch block: block state does not match world state");
+                        return;
+                    }
+                    // no point writing this tree if another one has already failed
+                    if (!success) {
+                        signal.signal_decrement();
+                        return;
+                    }
+                    uint64_t block_height = meta.unfinalisedBlockHeight;
+                    tree->commit([&, id, block_height](const Response& commit_response) {
+                        if (!commit_response.success) {
+                            fail(commit_response.message);
+                            return;
+                        }
+                        {
+                            std::lock_guard<std::mutex> lock(committed_mutex);
+                            committed_block_heights[id] = block_height;
+                        }
+                        signal.signal_decrement();
+                    });
+                });
+            },
+            fork->_trees.at(id));
+    };
+
+    add_block_to_trees(fork,
+                       block_header_hash,
+                       notes,
+                       l1_to_l2_messages,
+                       nullifiers,
+                       public_writes,
+                       [&](MerkleTreeId id, const Response& response) {
+                           if (!response.success) {
+                               fail(response.message);
+                           } else if (id == MerkleTreeId::ARCHIVE) {
+                               signal.signal_decrement();
+                           } else {
+                               verify_and_commit(id);
+                           }
+                       });
+    signal.wait_for_level();
+
+    if (!success) {
+        revert_partial_block(committed_block_heights, "Failed to sync block: " + err_message);
+    }
+
+    if (!is_archive_tip(WorldStateRevision::uncommitted(), block_header_hash)) {
+        revert_partial_block(committed_block_heights,
+                             "Can't synch block: block header hash is not the tip of the archive tree");
+    }
+
+    {
+        auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::ARCHIVE));
+        Signal archive_signal;
+        wrapper.tree->commit([&](const Response& response) {
+            success = response.success;
+            err_message = response.message;
+            archive_signal.signal_level();
+        });
+        archive_signal.wait_for_level();
+    }
+
+    if (!success) {
+        revert_partial_block(committed_block_heights, "Commit failed: " + err_message);
+    }
+    get_status(status);
+    return status;
+}
+
+WorldStateStatus WorldState::sync_blocks(const std::vector<SyncBlockRequest>& blocks)
+{
+    WorldStateStatus status;
+    rollback();
+    if (blocks.empty()) {
+        get_status(status);
+        return status;
+    }
+
+    // The blocks are applied one after the other in memory. Each tree records the root and size it has at the end
+    // of every block and then writes all of them, and the nodes they share, in a single commit at the end
+    Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        const SyncBlockRequest& block = blocks[i];
+        if (i > 0 && block.blockNumber != blocks[i - 1].blockNumber + 1) {
+            rollback();
+            throw std::runtime_error("Can't synch blocks: block numbers are not consecutive");
+        }
+
+        Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+        std::atomic_bool success = true;
+        std::string err_message;
+        add_block_to_trees(fork,
+                           block.blockHeaderHash,
+                           block.paddedNoteHashes,
+                           block.paddedL1ToL2Messages,
+                           block.paddedNullifiers,
+                           block.batchesOfPaddedPublicDataWrites,
+                           [&](MerkleTreeId, const Response& response) {
+                               // take the first error
+                               bool expected = true;
+                               if (!response.success && success.compare_exchange_strong(expected, false)) {
+                                   err_message = response.message;
+                               }
+                               signal.signal_decrement();
+                           });
+        signal.wait_for_level();
+
+        std::string block_name = "block " + std::to_string(block.blockNumber);
+        if (!success) {
+            rollback();
+            throw std::runtime_error("Failed to sync " + block_name + ": " + err_message);
+        }
+        if (!is_archive_tip(WorldStateRevision::uncommitted(), block.blockHeaderHash)) {
+            rollback();
+            throw std::runtime_error("Can't synch " + block_name +
+                                     ": block header hash is not the tip of the archive tree");
+        }
+        if (!is_same_state_reference(WorldStateRevision::uncommitted(), block.blockStateRef)) {
+            rollback();
+            throw std::runtime_error("Can't synch " + block_name + ": block state does not match world state");
+        }
+
+        Signal checkpoint_signal(static_cast<uint32_t>(fork->_trees.size()));
+        for (auto& [id, tree] : fork->_trees) {
+            std::visit(
+                [&](auto&& wrapper) {
+                    wrapper.tree->checkpoint_block([&](const Response& response) {
+                        if (!response.success) {
+                            success = false;
+                        }
+                        checkpoint_signal.signal_decrement();
+                    });
+                },
+                tree);
+        }
+        checkpoint_signal.wait_for_level();
+        if (!success) {
+            rollback();
+            throw std::runtime_error("Failed to sync " + block_name + ": could not record the block");
+        }
+    }
+
+    // As in sync_block, the archive, which our block height is read from, is only committed once all the other trees
+    // have been, and the trees that were written are unwound if any commit fails
+    std::unordered_map<MerkleTreeId, uint64_t> committed_block_heights;
+    for (const auto& [id, tree] : fork->_trees) {
+        committed_block_heights[id] = get_tree_info(WorldStateRevision::committed(), id).meta.unfinalisedBlockHeight;
+    }
+    std::atomic_bool success = true;
+    std::string err_message;
+    auto commit_tree = [&](MerkleTreeId id, Signal& committed) {
+        std::visit(
+            [&](auto&& wrapper) {
+                wrapper.tree->commit([&](const Response& response) {
+                    // take the first error
+                    bool expected = true;
+                    if (!response.success && success.compare_exchange_strong(expected, false)) {
+                        err_message = response.message;
+                    }
+                    committed.signal_decrement();
+                });
+            },
+            fork->_trees.at(id));
+    };
+
+    Signal state_trees_signal(static_cast<uint32_t>(fork->_trees.size()) - 1);
+    for (const auto& [id, tree] : fork->_trees) {
+        if (id != MerkleTreeId::ARCHIVE) {
+            commit_tree(id, state_trees_signal);
+        }
+    }
+    state_trees_signal.wait_for_level();
+    if (success) {
+        Signal archive_signal;
+        commit_tree(MerkleTreeId::ARCHIVE, archive_signal);
+        archive_signal.wait_for_level();
+    }
+
+    if (!success) {
+        revert_partial_block(committed_block_heights, "Commit failed: " + err_message);
+    }
+    get_status(status);
+    return status;
+}
+
+/**
+ * @brief Applies the updates of a block to the trees of the fork
+ * @details The trees are updated concurrently and on_tree_updated is called once for each of them as it finishes. The
+ * updates must be kept alive until then.
+ */
+void WorldState::add_block_to_trees(const Fork::SharedPtr& fork,
+                                    const bb::fr& block_header_hash,
+                                    const std::vector<bb::fr>& notes,
+                                    const std::vector<bb::fr>& l1_to_l2_messages,
+                                    const std::vector<NullifierLeafValue>& nullifiers,
+                                    const std::vector<std::vector<PublicDataLeafValue>>& public_writes,
+                                    const TreeUpdateCallback& on_tree_updated)
+{
+    auto report = [on_tree_updated](MerkleTreeId id) {
+        return [on_tree_updated, id](const auto& response) {
+            on_tree_updated(id, Response{ .success = response.success, .message = response.message });
+        };
+    };
+
     {
         auto& wrapper = std::get<TreeWithStore<NullifierTree>>(fork->_trees.at(MerkleTreeId::NULLIFIER_TREE));
-        NullifierTree::AddCompletionCallback completion = [&](const auto&) -> void { signal.signal_decrement(); };
+        NullifierTree::AddCompletionCallback completion = report(MerkleTreeId::NULLIFIER_TREE);
         wrapper.tree->add_or_update_values(nullifiers, 0, completion);
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::NOTE_HASH_TREE));
-        wrapper.tree->add_values(notes, decr);
+        wrapper.tree->add_values(notes, report(MerkleTreeId::NOTE_HASH_TREE));
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE));
-        wrapper.tree->add_values(l1_to_l2_messages, decr);
+        wrapper.tree->add_values(l1_to_l2_messages, report(MerkleTreeId::L1_TO_L2_MESSAGE_TREE));
     }
 
     {
         auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(MerkleTreeId::ARCHIVE));
-        wrapper.tree->add_value(block_header_hash, decr);
+        wrapper.tree->add_value(block_header_hash, report(MerkleTreeId::ARCHIVE));
     }
 
-    // finally insert the public writes and wait for all the operations to end
     {
+        auto& wrapper = std::get<TreeWithStore<PublicDataTree>>(fork->_trees.at(MerkleTreeId::PUBLIC_DATA_TREE));
+        PublicDataTree::AddCompletionCallback on_public_data = report(MerkleTreeId::PUBLIC_DATA_TREE);
+        std::optional<std::vector<PublicDataLeafValue>> merged_writes = merge_public_data_writes(public_writes);
+        if (merged_writes.has_value()) {
+            wrapper.tree->add_or_update_values(merged_writes.value(), 0, on_public_data);
+            return;
+        }
+
         // insert public writes in batches so that we can have different transactions modifying the same slot in the
         // same L2 block
-        auto& wrapper = std::get<TreeWithStore<PublicDataTree>>(fork->_trees.at(MerkleTreeId::PUBLIC_DATA_TREE));
-        std::atomic_uint64_t current_batch = 0;
-        PublicDataTree::AddCompletionCallback completion = [&](const auto& resp) -> void {
-            current_batch++;
-            if (current_batch == public_writes.size()) {
-                decr(resp);
-            } else {
-                wrapper.tree->add_or_update_values(public_writes[current_batch], 0, completion);
+        struct PublicDataBatches {
+            PublicDataTree* tree;
+            const std::vector<std::vector<PublicDataLeafValue>>* batches;
+            size_t next_batch;
+            PublicDataTree::AddCompletionCallback on_completion;
+
+            static void insert_next(const std::shared_ptr<PublicDataBatches>& state)
+            {
+                const auto& batch = state->batches->at(state->next_batch++);
+                state->tree->add_or_update_values(batch, 0, [state](const auto& response) {
+                    if (!response.success || state->next_batch == state->batches->size()) {
+                        state->on_completion(response);
+                    } else {
+                        insert_next(state);
+                    }
+                });
             }
         };
-
-        if (public_writes.empty()) {
-            signal.signal_decrement();
-        } else {
-            wrapper.tree->add_or_update_values(public_writes[current_batch], 0, completion);
-        }
-
-        // block inside this scope in order to keep current_batch/completion alive until the end of all operations
-        signal.wait_for_level();
+        PublicDataBatches::insert_next(std::make_shared<PublicDataBatches>(PublicDataBatches{
+            .tree = wrapper.tree.get(), .batches = &public_writes, .next_batch = 0, .on_completion = on_public_data }));
     }
+}
 
-    if (!success) {
-        throw std::runtime_error("Failed to sync block: " + err_message);
-    }
+/**
+ * @brief Undoes a block sync that failed after some of the trees had already been committed, then throws its error
+ * @details Every block a tree has committed past its recorded height is unwound, latest first. If a committed tree
+ * can't be unwound, the world state is left inconsistent and the error says so.
+ * @param committed_block_heights The block height of each committed tree before its commit
+ * @param error_message The reason the sync failed
+ */
+void WorldState::revert_partial_block(const std::unordered_map<MerkleTreeId, uint64_t>& committed_block_heights,
+                                      const std::string& error_message)
+{
+    rollback();
 
-    if (!is_archive_tip(WorldStateRevision::uncommitted(), block_header_hash)) {
-        throw std::runtime_error("Can't synch block: block header hash is not the tip of the archive tree");
+    Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
+    std::string unwind_errors;
+    for (const auto& [id, block_height] : committed_block_heights) {
+        // a tree without any changes doesn't record a new block when committed
+        TreeMetaResponse info = get_tree_info(WorldStateRevision::committed(), id);
+        for (uint64_t block = info.meta.unfinalisedBlockHeight; block > block_height; --block) {
+            Response unwind_response{ .success = false, .message = "" };
+            std::visit(
+                [&](auto&& wrapper) {
+                    Signal signal;
+                    wrapper.tree->unwind_block(block, [&](const Response& response) {
+                        unwind_response = response;
+                        signal.signal_level();
+                    });
+                    signal.wait_for_level();
+                },
+                fork->_trees.at(id));
+            if (!unwind_response.success) {
+                unwind_errors += "\n" + getMerkleTreeName(id) + ": " + unwind_response.message;
+                break;
+            }
+        }
     }
 
-    if (!is_same_state_reference(WorldStateRevision::uncommitted(), block_state_ref)) {
-        throw std::runtime_error("Can't synch block: block state does not match world state");
+    if (!unwind_errors.empty()) {
+        throw std::runtime_error(error_message + "\nWorld state is inconsistent, failed to unwind the block from:" +
+                                 unwind_errors);
     }
+    throw std::runtime_error(error_message);
+}
 
-    if (!commit()) {
-        throw std::runtime_error("Commit failed");
+/**
+ * @brief Merges a block's batches of public data writes into a single batch leaving the tree in the same state
+ * @details Every batch appends as many leaves as it has writes, with an empty leaf for each write that updates an
+ * existing slot. Keeping only the final value of each slot, at the position of its first write, and an empty leaf for
+ * all of its later writes therefore gives the same tree as inserting the batches in turn. Returns nullopt if a batch
+ * writes to the same slot twice, which the tree has to reject.
+ */
+std::optional<std::vector<PublicDataLeafValue>> WorldState::merge_public_data_writes(
+    const std::vector<std::vector<PublicDataLeafValue>>& batches)
+{
+    struct SlotWrite {
+        size_t position;
+        size_t batch;
+    };
+    size_t num_writes = 0;
+    for (const auto& batch : batches) {
+        num_writes += batch.size();
+    }
+    std::vector<PublicDataLeafValue> merged;
+    merged.reserve(num_writes);
+    std::unordered_map<fr, SlotWrite> writes;
+    writes.reserve(num_writes);
+
+    for (size_t i = 0; i < batches.size(); ++i) {
+        for (const PublicDataLeafValue& value : batches[i]) {
+            if (value.is_empty()) {
+                merged.push_back(value);
+                continue;
+            }
+            auto [it, inserted] = writes.try_emplace(value.slot, SlotWrite{ .position = merged.size(), .batch = i });
+            if (inserted) {
+                merged.push_back(value);
+                continue;
+            }
+            if (it->second.batch == i) {
+                return std::nullopt;
+            }
+            it->second.batch = i;
+            merged[it->second.position] = value;
+            merged.push_back(PublicDataLeafValue::empty());
+        }
     }
-    get_status(status);
-    return status;
+    return merged;
 }
 
 GetLowIndexedLeafResponse WorldState::find_low_leaf_index(const WorldStateRevision& revision,
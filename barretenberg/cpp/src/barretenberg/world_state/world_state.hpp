@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <optional>
@@ -223,7 +224,17 @@ class WorldState {
         const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
         const std::vector<std::vector<crypto::merkle_tree::PublicDataLeafValue>>& public_writes);
 
+    /**
+     * @brief Syncs a range of consecutive blocks, committing them all at once
+     * @details Equivalent to calling sync_block for each of them, but the blocks are applied in memory and written to
+     * the stores in a single commit. If any block fails to apply, none of them are committed, and if a tree fails to
+     * commit, the blocks the other trees have already written are unwound.
+     */
+    WorldStateStatus sync_blocks(const std::vector<SyncBlockRequest>& blocks);
+
   private:
+    using TreeUpdateCallback = std::function<void(MerkleTreeId, const crypto::merkle_tree::Response&)>;
+
     std::shared_ptr<bb::ThreadPool> _workers;
     WorldStateStores::Ptr _persistentStores;
 
@@ -253,6 +264,21 @@ class WorldState {
     bool is_archive_tip(const WorldStateRevision& revision, const bb::fr& block_header_hash) const;
 
     bool is_same_state_reference(const WorldStateRevision& revision, const StateReference& state_ref) const;
+
+    static void add_block_to_trees(
+        const Fork::SharedPtr& fork,
+        const bb::fr& block_header_hash,
+        const std::vector<bb::fr>& notes,
+        const std::vector<bb::fr>& l1_to_l2_messages,
+        const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
+        const std::vector<std::vector<crypto::merkle_tree::PublicDataLeafValue>>& public_writes,
+        const TreeUpdateCallback& on_tree_updated);
+
+    [[noreturn]] void revert_partial_block(const std::unordered_map<MerkleTreeId, uint64_t>& committed_block_heights,
+                                           const std::string& error_message);
+
+    static std::optional<std::vector<crypto::merkle_tree::PublicDataLeafValue>> merge_public_data_writes(
+        const std::vector<std::vector<crypto::merkle_tree::PublicDataLeafValue>>& batches);
     static bb::fr compute_initial_archive(const StateReference& initial_state_ref, uint32_t generator_point);
 
     static StateReference get_state_reference(const WorldStateRevision& revision,
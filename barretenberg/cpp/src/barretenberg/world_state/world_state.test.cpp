@@ -778,3 +778,191 @@ TEST_F(WorldStateTest, BuildsABlockInAFork)
 
     EXPECT_EQ(fork_state_ref, ws.get_state_reference(WorldStateRevision::committed()));
 }
+
+TEST_F(WorldStateTest, SyncBlockWithSlotsWrittenAcrossBatches)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    auto fork_id = ws.create_fork(0);
+
+    // slots 150 and 151 are new, slot 1 is already in the tree
+    std::vector<std::vector<PublicDataLeafValue>> public_writes{
+        { { 150, 1 }, { 151, 1 }, { 1, 5 } },
+        { { 150, 2 }, { 152, 1 } },
+        { { 151, 3 }, { 1, 6 }, { 150, 4 } },
+    };
+    for (const auto& batch : public_writes) {
+        ws.batch_insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, batch, 0, fork_id);
+    }
+    auto fork_state_ref = ws.get_state_reference(WorldStateRevision{ .forkId = fork_id, .includeUncommitted = true });
+    ws.delete_fork(fork_id);
+
+    ws.sync_block(fork_state_ref, { 1 }, {}, {}, {}, public_writes);
+
+    EXPECT_EQ(fork_state_ref, ws.get_state_reference(WorldStateRevision::committed()));
+    assert_leaf_value(
+        ws, WorldStateRevision::committed(), MerkleTreeId::PUBLIC_DATA_TREE, 128, PublicDataLeafValue(150, 4));
+    assert_leaf_value(
+        ws, WorldStateRevision::committed(), MerkleTreeId::PUBLIC_DATA_TREE, 129, PublicDataLeafValue(151, 3));
+    assert_leaf_value(
+        ws, WorldStateRevision::committed(), MerkleTreeId::PUBLIC_DATA_TREE, 1, PublicDataLeafValue(1, 6));
+}
+
+TEST_F(WorldStateTest, SyncBlocksMatchesSyncingEachBlock)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    WorldState batched_ws(
+        thread_pool_size, data_dir + "/batched", map_size, tree_heights, tree_prefill, initial_header_generator_point);
+
+    std::vector<SyncBlockRequest> blocks;
+    for (uint64_t i = 1; i <= 3; ++i) {
+        SyncBlockRequest block{
+            .blockNumber = i,
+            .blockHeaderHash = fr(1000 + i),
+        };
+        // the second block is empty
+        if (i != 2) {
+            block.paddedNoteHashes = { fr(10 * i), fr(10 * i + 1) };
+            block.paddedL1ToL2Messages = { fr(10 * i + 2) };
+            block.paddedNullifiers = { NullifierLeafValue(200 + i) };
+            // slot 300 is written by both non-empty blocks
+            block.batchesOfPaddedPublicDataWrites = {
+                { PublicDataLeafValue(300, i), PublicDataLeafValue(300 + i, 1) },
+            };
+        }
+
+        ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, block.paddedNoteHashes);
+        ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, block.paddedL1ToL2Messages);
+        ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, block.paddedNullifiers, 0);
+        for (const auto& batch : block.batchesOfPaddedPublicDataWrites) {
+            ws.batch_insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, batch, 0);
+        }
+        block.blockStateRef = ws.get_state_reference(WorldStateRevision::uncommitted());
+        ws.rollback();
+
+        ws.sync_block(block.blockStateRef,
+                      block.blockHeaderHash,
+                      block.paddedNoteHashes,
+                      block.paddedL1ToL2Messages,
+                      block.paddedNullifiers,
+                      block.batchesOfPaddedPublicDataWrites);
+        blocks.push_back(block);
+    }
+
+    WorldStateStatus status = batched_ws.sync_blocks(blocks);
+    WorldStateStatus expected_status;
+    ws.get_status(expected_status);
+    EXPECT_EQ(status, expected_status);
+    EXPECT_EQ(status.unfinalisedBlockNumber, 3);
+
+    std::vector<MerkleTreeId> tree_ids{
+        MerkleTreeId::NULLIFIER_TREE,        MerkleTreeId::NOTE_HASH_TREE, MerkleTreeId::PUBLIC_DATA_TREE,
+        MerkleTreeId::L1_TO_L2_MESSAGE_TREE, MerkleTreeId::ARCHIVE,
+    };
+    for (uint64_t block_number = 1; block_number <= 3; ++block_number) {
+        WorldStateRevision revision{ .blockNumber = block_number };
+        for (auto id : tree_ids) {
+            EXPECT_EQ(ws.get_tree_info(revision, id).meta, batched_ws.get_tree_info(revision, id).meta);
+        }
+    }
+    for (auto id : tree_ids) {
+        EXPECT_EQ(ws.get_tree_info(WorldStateRevision::committed(), id).meta,
+                  batched_ws.get_tree_info(WorldStateRevision::committed(), id).meta);
+    }
+    assert_leaf_value(
+        batched_ws, WorldStateRevision::committed(), MerkleTreeId::PUBLIC_DATA_TREE, 128, PublicDataLeafValue(300, 3));
+}
+
+TEST_F(WorldStateTest, SyncBlocksCommitsNothingIfABlockFails)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    StateReference initial_state_ref = ws.get_state_reference(WorldStateRevision::committed());
+
+    // the first block is empty and valid, the second one doesn't match its state reference
+    std::vector<SyncBlockRequest> blocks{
+        { .blockNumber = 1, .blockStateRef = initial_state_ref, .blockHeaderHash = fr(1) },
+        { .blockNumber = 2, .blockStateRef = initial_state_ref, .blockHeaderHash = fr(2), .paddedNoteHashes = { 42 } },
+    };
+    EXPECT_THROW(ws.sync_blocks(blocks), std::runtime_error);
+
+    EXPECT_EQ(initial_state_ref, ws.get_state_reference(WorldStateRevision::uncommitted()));
+    WorldStateStatus status;
+    ws.get_status(status);
+    EXPECT_EQ(status.unfinalisedBlockNumber, 0);
+}
+
+TEST_F(WorldStateTest, FailedSyncDoesNotCommitAnyTree)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    StateReference initial_state_ref = ws.get_state_reference(WorldStateRevision::committed());
+    StateReference block_state_ref = initial_state_ref;
+    // the note hash tree will match the block, the nullifier tree will not
+    block_state_ref[MerkleTreeId::NOTE_HASH_TREE] = {
+        fr("0x15dad063953d8d216c1db77739d6fb27e1b73a5beef748a1208898b3428781eb"), 1
+    };
+
+    EXPECT_THROW(ws.sync_block(block_state_ref, fr(1), { 42 }, {}, { NullifierLeafValue(144) }, {}),
+                 std::runtime_error);
+
+    EXPECT_EQ(initial_state_ref, ws.get_state_reference(WorldStateRevision::committed()));
+    EXPECT_EQ(initial_state_ref, ws.get_state_reference(WorldStateRevision::uncommitted()));
+    WorldStateStatus status;
+    ws.get_status(status);
+    EXPECT_EQ(status.unfinalisedBlockNumber, 0);
+}
+
+TEST_F(WorldStateTest, SyncBlocksUnwindsTreesIfACommitFails)
+{
+    // the note hash tree's store is too small to hold the blocks, so it fails to commit while the others succeed
+    std::unordered_map<MerkleTreeId, uint64_t> map_sizes{
+        { MerkleTreeId::NULLIFIER_TREE, map_size },  { MerkleTreeId::PUBLIC_DATA_TREE, map_size },
+        { MerkleTreeId::ARCHIVE, map_size },         { MerkleTreeId::NOTE_HASH_TREE, 128 },
+        { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, map_size },
+    };
+    WorldState ws(thread_pool_size, data_dir, map_sizes, tree_heights, tree_prefill, initial_header_generator_point);
+    StateReference initial_state_ref = ws.get_state_reference(WorldStateRevision::committed());
+    std::vector<MerkleTreeId> tree_ids{
+        MerkleTreeId::NULLIFIER_TREE,        MerkleTreeId::NOTE_HASH_TREE, MerkleTreeId::PUBLIC_DATA_TREE,
+        MerkleTreeId::L1_TO_L2_MESSAGE_TREE, MerkleTreeId::ARCHIVE,
+    };
+    std::unordered_map<MerkleTreeId, TreeMeta> initial_meta;
+    for (auto id : tree_ids) {
+        initial_meta[id] = ws.get_tree_info(WorldStateRevision::committed(), id).meta;
+    }
+
+    // two blocks, so that the trees which did commit have more than one block to unwind
+    std::vector<SyncBlockRequest> blocks;
+    for (uint64_t i = 1; i <= 2; ++i) {
+        SyncBlockRequest block{
+            .blockNumber = i,
+            .blockHeaderHash = fr(1000 + i),
+            .paddedL1ToL2Messages = { fr(10 * i) },
+            .paddedNullifiers = { NullifierLeafValue(200 + i) },
+            .batchesOfPaddedPublicDataWrites = { { PublicDataLeafValue(300 + i, 1) } },
+        };
+        // distinct leaves, as the tree stores identical subtrees once
+        for (uint64_t j = 0; j < 2048; ++j) {
+            block.paddedNoteHashes.emplace_back(10000 * i + j);
+        }
+        ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, block.paddedNoteHashes);
+        ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, block.paddedL1ToL2Messages);
+        ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, block.paddedNullifiers, 0);
+        ws.batch_insert_indexed_leaves<PublicDataLeafValue>(
+            MerkleTreeId::PUBLIC_DATA_TREE, block.batchesOfPaddedPublicDataWrites[0], 0);
+        block.blockStateRef = ws.get_state_reference(WorldStateRevision::uncommitted());
+        blocks.push_back(block);
+    }
+    ws.rollback();
+
+    EXPECT_THROW(ws.sync_blocks(blocks), std::runtime_error);
+
+    EXPECT_EQ(initial_state_ref, ws.get_state_reference(WorldStateRevision::committed()));
+    EXPECT_EQ(initial_state_ref, ws.get_state_reference(WorldStateRevision::uncommitted()));
+    for (auto id : tree_ids) {
+        EXPECT_EQ(ws.get_tree_info(WorldStateRevision::committed(), id).meta.unfinalisedBlockHeight,
+                  initial_meta[id].unfinalisedBlockHeight);
+        EXPECT_EQ(ws.get_tree_info(WorldStateRevision::committed(), id).meta.size, initial_meta[id].size);
+    }
+    WorldStateStatus status;
+    ws.get_status(status);
+    EXPECT_EQ(status.unfinalisedBlockNumber, 0);
+}
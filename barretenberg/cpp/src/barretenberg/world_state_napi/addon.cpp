@@ -181,6 +181,10 @@ WorldStateAddon::WorldStateAddon(const Napi::CallbackInfo& info)
         WorldStateMessageType::SYNC_BLOCK,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return sync_block(obj, buffer); });
 
+    _dispatcher.registerTarget(
+        WorldStateMessageType::SYNC_BLOCKS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return sync_blocks(obj, buffer); });
+
     _dispatcher.registerTarget(
         WorldStateMessageType::CREATE_FORK,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return create_fork(obj, buffer); });
@@ -568,6 +572,20 @@ bool WorldStateAddon::sync_block(msgpack::object& obj, msgpack::sbuffer& buf)
     return true;
 }
 
+bool WorldStateAddon::sync_blocks(msgpack::object& obj, msgpack::sbuffer& buf)
+{
+    TypedMessage<SyncBlocksRequest> request;
+    obj.convert(request);
+
+    WorldStateStatus status = _ws->sync_blocks(request.value.blocks);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<SyncBlockResponse> resp_msg(WorldStateMessageType::SYNC_BLOCKS, header, { status });
+    msgpack::pack(buf, resp_msg);
+
+    return true;
+}
+
 bool WorldStateAddon::create_fork(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<CreateForkRequest> request;
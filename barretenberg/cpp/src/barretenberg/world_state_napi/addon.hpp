@@ -51,6 +51,7 @@ class WorldStateAddon : public Napi::ObjectWrap<WorldStateAddon> {
     bool rollback(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool sync_block(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool sync_blocks(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool create_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool delete_fork(msgpack::object& obj, msgpack::sbuffer& buffer);
@@ -43,6 +43,8 @@ enum WorldStateMessageType {
 
     GET_STATUS,
 
+    SYNC_BLOCKS,
+
     CLOSE = 999,
 };
 
@@ -192,6 +194,11 @@ struct SyncBlockRequest {
                    batchesOfPaddedPublicDataWrites);
 };
 
+struct SyncBlocksRequest {
+    std::vector<SyncBlockRequest> blocks;
+    MSGPACK_FIELDS(blocks);
+};
+
 struct SyncBlockResponse {
     WorldStateStatus status;
     MSGPACK_FIELDS(status);
@@ -77,6 +77,8 @@ export enum WorldStateMessageType {
 
   GET_STATUS,
 
+  SYNC_BLOCKS,
+
   CLOSE = 999,
 }
 
@@ -193,6 +195,10 @@ interface SyncBlockRequest {
   batchesOfPaddedPublicDataWrites: readonly SerializedLeafValue[][];
 }
 
+interface SyncBlocksRequest {
+  blocks: readonly SyncBlockRequest[];
+}
+
 interface SyncBlockResponse {
   status: WorldStateStatus;
 }
@@ -249,6 +255,8 @@ export type WorldStateRequest = {
 
   [WorldStateMessageType.GET_STATUS]: void;
 
+  [WorldStateMessageType.SYNC_BLOCKS]: SyncBlocksRequest;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 
@@ -283,6 +291,8 @@ export type WorldStateResponse = {
 
   [WorldStateMessageType.GET_STATUS]: WorldStateStatus;
 
+  [WorldStateMessageType.SYNC_BLOCKS]: SyncBlockResponse;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 